@@ -0,0 +1,126 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+#include "app/activity.h"
+
+// Every ACTIVITY_SCAN_INTERVAL linear scan steps one hot bin is revisited
+#define ACTIVITY_SCAN_INTERVAL	8U
+#define ACTIVITY_HIT_WEIGHT	32U
+#define ACTIVITY_MIN_SCORE	16U
+// Scores lose 1/8 every 30s
+#define ACTIVITY_DECAY_PERIOD	60U
+
+ACTIVITY_Bin_t gActivityBins[ACTIVITY_BINS];
+bool gActivityScanEnabled;
+
+static uint8_t ScanCounter;
+static uint8_t DecayCounter;
+
+static ACTIVITY_Bin_t *ACTIVITY_FindBin(uint32_t Frequency)
+{
+	ACTIVITY_Bin_t *pLowest;
+	uint8_t i;
+
+	pLowest = &gActivityBins[0];
+	for (i = 0; i < ACTIVITY_BINS; i++) {
+		if (gActivityBins[i].Score && gActivityBins[i].Frequency == Frequency) {
+			return &gActivityBins[i];
+		}
+		if (gActivityBins[i].Score < pLowest->Score) {
+			pLowest = &gActivityBins[i];
+		}
+	}
+
+	// Evicted bins hand their score over so a new frequency is not starved
+	// by a table full of slowly decaying entries.
+	pLowest->Frequency = Frequency;
+	pLowest->Credit = 0;
+
+	return pLowest;
+}
+
+void ACTIVITY_Clear(void)
+{
+	memset(gActivityBins, 0, sizeof(gActivityBins));
+	ScanCounter = 0;
+}
+
+void ACTIVITY_RecordHit(uint32_t Frequency)
+{
+	ACTIVITY_Bin_t *pBin = ACTIVITY_FindBin(Frequency);
+
+	if (pBin->Score > 0xFF - ACTIVITY_HIT_WEIGHT) {
+		pBin->Score = 0xFF;
+	} else {
+		pBin->Score += ACTIVITY_HIT_WEIGHT;
+	}
+}
+
+void ACTIVITY_Seed(uint32_t Frequency, uint8_t Score)
+{
+	ACTIVITY_FindBin(Frequency)->Score = Score;
+}
+
+void ACTIVITY_TimeSlice500ms(void)
+{
+	uint8_t i;
+
+	if (++DecayCounter < ACTIVITY_DECAY_PERIOD) {
+		return;
+	}
+	DecayCounter = 0;
+	for (i = 0; i < ACTIVITY_BINS; i++) {
+		gActivityBins[i].Score -= (gActivityBins[i].Score + 7) / 8;
+	}
+}
+
+// Smooth weighted round robin: hot bins are picked in proportion to their
+// score without any two visits of the same bin bunching together.
+bool ACTIVITY_SelectScanFrequency(uint32_t Lower, uint32_t Upper, uint32_t *pFrequency)
+{
+	ACTIVITY_Bin_t *pBest;
+	int16_t Total;
+	uint8_t i;
+
+	if (!gActivityScanEnabled || ++ScanCounter < ACTIVITY_SCAN_INTERVAL) {
+		return false;
+	}
+	ScanCounter = 0;
+
+	pBest = NULL;
+	Total = 0;
+	for (i = 0; i < ACTIVITY_BINS; i++) {
+		ACTIVITY_Bin_t *pBin = &gActivityBins[i];
+
+		if (pBin->Score < ACTIVITY_MIN_SCORE || pBin->Frequency < Lower || pBin->Frequency > Upper) {
+			continue;
+		}
+		pBin->Credit += pBin->Score;
+		Total += pBin->Score;
+		if (pBest == NULL || pBin->Credit > pBest->Credit) {
+			pBest = pBin;
+		}
+	}
+	if (pBest == NULL) {
+		return false;
+	}
+	pBest->Credit -= Total;
+	*pFrequency = pBest->Frequency;
+
+	return true;
+}
+
@@ -0,0 +1,42 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_ACTIVITY_H
+#define APP_ACTIVITY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ACTIVITY_BINS 16U
+
+typedef struct {
+	uint32_t Frequency;
+	int16_t Credit;
+	uint8_t Score;
+	uint8_t Padding;
+} ACTIVITY_Bin_t;
+
+extern ACTIVITY_Bin_t gActivityBins[ACTIVITY_BINS];
+extern bool gActivityScanEnabled;
+
+void ACTIVITY_Clear(void);
+void ACTIVITY_RecordHit(uint32_t Frequency);
+void ACTIVITY_Seed(uint32_t Frequency, uint8_t Score);
+void ACTIVITY_TimeSlice500ms(void);
+bool ACTIVITY_SelectScanFrequency(uint32_t Lower, uint32_t Upper, uint32_t *pFrequency);
+
+#endif
+
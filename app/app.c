@@ -20,11 +20,13 @@
 
 #include "ARMCM0.h"
 #include "app/action.h"
+#include "app/activity.h"
 #include "app/dtmf.h"
 #include "app/generic.h"
 #include "app/main.h"
 #include "app/menu.h"
 #include "app/scanner.h"
+#include "app/spectrum.h"
 #include "app/uart.h"
 #include "audio.h"
 #include "board.h"
@@ -35,11 +37,13 @@
 #include "driver/keyboard.h"
 #include "driver/st7565.h"
 #include "driver/system.h"
+#include "driver/systick.h"
 #include "dtmf.h"
 #include "external/printf/printf.h"
 #include "frequencies.h"
 #include "functions.h"
 #include "helper/battery.h"
+#include "helper/energy.h"
 #include "misc.h"
 #include "radio.h"
 #include "settings.h"
@@ -51,12 +55,27 @@
 #include "ui/status.h"
 #include "ui/ui.h"
 
+#define RADIO_POLL_INTERVAL_RX_US 2000U
+#define RADIO_POLL_INTERVAL_IDLE_US 10000U
+#define RADIO_POLL_INTERVAL_TX_US 10000U
+#define RADIO_POLL_INTERVAL_SAVE_US 10000U
+
 static void APP_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
 
+static uint32_t gScanResumeFrequency;
+static uint32_t gRadioPollTimestamp;
+static uint32_t gRadioPollInterval;
+
+uint16_t gRadioInterruptMask;
+uint32_t gRadioInterruptTimestamp;
+uint32_t gRadioPollLateMaxUs;
+static KEY_Code_t gInjectedKeyReport = KEY_INVALID;
+
 static void APP_CheckForIncoming(void) {
     if (!g_SquelchLost) {
         return;
     }
+    ACTIVITY_RecordHit(gRxVfo->pCurrent->Frequency);
     if (gScanState == SCAN_OFF) {
         if (gCssScanMode != CSS_SCAN_MODE_OFF &&
             gRxReceptionMode == RX_MODE_NONE) {
@@ -353,7 +372,22 @@ void APP_SetFrequencyByStep(VFO_Info_t *pInfo, int8_t Step) {
 }
 
 static void FREQ_NextChannel(void) {
-    APP_SetFrequencyByStep(gRxVfo, gScanState);
+    uint32_t Frequency;
+
+    // A hot bin visit is a detour, the linear sweep resumes where it left off
+    if (gScanResumeFrequency) {
+        gRxVfo->ConfigRX.Frequency = gScanResumeFrequency;
+        gScanResumeFrequency = 0;
+        APP_SetFrequencyByStep(gRxVfo, gScanState);
+    } else if (ACTIVITY_SelectScanFrequency(
+                   LowerLimitFrequencyBandTable[gRxVfo->Band],
+                   UpperLimitFrequencyBandTable[gRxVfo->Band], &Frequency) &&
+               Frequency != gRxVfo->ConfigRX.Frequency) {
+        gScanResumeFrequency = gRxVfo->ConfigRX.Frequency;
+        gRxVfo->ConfigRX.Frequency = Frequency;
+    } else {
+        APP_SetFrequencyByStep(gRxVfo, gScanState);
+    }
     RADIO_ApplyOffset(gRxVfo);
     RADIO_ConfigureSquelchAndOutputPower(gRxVfo);
     RADIO_SetupRegisters(true);
@@ -426,76 +460,125 @@ void DUALWATCH_Alternate(void) {
     gDualWatchCountdown = 10;
 }
 
+// Handles the REG_02 flags of one interrupt. Anything that depends on the
+// chip state at the time (DTMF code, CDCSS type) comes from the same bus
+// session, so nothing has to go back to the BK4819.
+static void APP_HandleRadioInterrupt(uint16_t Status, uint16_t Mask) {
+    if (Mask & BK4819_REG_02_DTMF_5TONE_FOUND) {
+        gDTMF_RequestPending = true;
+        gDTMF_RecvTimeout = 5;
+        DTMF_Receive(BK4819_GetDTMF_5TONE_Code());
+        if (gCurrentFunction == FUNCTION_RECEIVE) {
+            DTMF_HandleRequest();
+        }
+    }
+    if (Mask & BK4819_REG_02_CxCSS_TAIL) {
+        g_CxCSS_TAIL_Found = true;
+    }
+    if (Mask & BK4819_REG_02_CDCSS_LOST) {
+        g_CDCSS_Lost = true;
+        gCDCSSCodeType = (Status >> 14) & 3;
+    }
+    if (Mask & BK4819_REG_02_CDCSS_FOUND) {
+        g_CDCSS_Lost = false;
+    }
+    if (Mask & BK4819_REG_02_CTCSS_LOST) {
+        g_CTCSS_Lost = true;
+    }
+    if (Mask & BK4819_REG_02_CTCSS_FOUND) {
+        g_CTCSS_Lost = false;
+    }
+    if (Mask & BK4819_REG_02_VOX_LOST) {
+        g_VOX_Lost = true;
+        gVoxPauseCountdown = 10;
+        if (gEeprom.VOX_SWITCH) {
+            if (gCurrentFunction == FUNCTION_POWER_SAVE && !gRxIdleMode) {
+                gBatterySave = 20;
+                gBatterySaveCountdownExpired = 0;
+            }
+            if (gEeprom.DUAL_WATCH != DUAL_WATCH_OFF &&
+                (gScheduleDualWatch || gDualWatchCountdown < 20)) {
+                gDualWatchCountdown = 20;
+                gScheduleDualWatch = false;
+            }
+        }
+    }
+    if (Mask & BK4819_REG_02_VOX_FOUND) {
+        g_VOX_Lost = false;
+        gVoxPauseCountdown = 0;
+    }
+    if (Mask & BK4819_REG_02_SQUELCH_LOST) {
+        g_SquelchLost = true;
+        BATTERY_NoteActivity();
+        BK4819_ToggleGpioOut(BK4819_GPIO0_PIN28_GREEN, true);
+    }
+    if (Mask & BK4819_REG_02_SQUELCH_FOUND) {
+        g_SquelchLost = false;
+        BK4819_ToggleGpioOut(BK4819_GPIO0_PIN28_GREEN, false);
+    }
+}
+
 void APP_CheckRadioInterrupts(void) {
-    if (gScreenToDisplay == DISPLAY_SCANNER) {
+    uint16_t Status;
+    uint16_t Mask;
+
+    if (gScreenToDisplay == DISPLAY_SCANNER ||
+        gScreenToDisplay == DISPLAY_SPECTRUM) {
         return;
     }
 
-    while (BK4819_GetRegister(BK4819_REG_0C) & 1U) {
-        uint16_t Mask;
+    while (BK4819_GetInterruptRequest(&Status, &Mask)) {
+        gRadioInterruptMask = Mask;
+        gRadioInterruptTimestamp = SYSTICK_GetTimestamp();
+        APP_HandleRadioInterrupt(Status, Mask);
+    }
+}
 
-        BK4819_WriteRegister(BK4819_REG_02, 0);
-        Mask = BK4819_GetRegister(BK4819_REG_02);
-        if (Mask & BK4819_REG_02_DTMF_5TONE_FOUND) {
-            gDTMF_RequestPending = true;
-            gDTMF_RecvTimeout = 5;
-            if (gDTMF_WriteIndex > 15) {
-                uint8_t i;
-                for (i = 0; i < sizeof(gDTMF_Received) - 1; i++) {
-                    gDTMF_Received[i] = gDTMF_Received[i + 1];
-                }
-                gDTMF_WriteIndex = 15;
-            }
-            gDTMF_Received[gDTMF_WriteIndex++] =
-                DTMF_GetCharacter(BK4819_GetDTMF_5TONE_Code());
-            if (gCurrentFunction == FUNCTION_RECEIVE) {
-                DTMF_HandleRequest();
-            }
-        }
-        if (Mask & BK4819_REG_02_CxCSS_TAIL) {
-            g_CxCSS_TAIL_Found = true;
-        }
-        if (Mask & BK4819_REG_02_CDCSS_LOST) {
-            g_CDCSS_Lost = true;
-            gCDCSSCodeType = BK4819_GetCDCSSCodeType();
-        }
-        if (Mask & BK4819_REG_02_CDCSS_FOUND) {
-            g_CDCSS_Lost = false;
-        }
-        if (Mask & BK4819_REG_02_CTCSS_LOST) {
-            g_CTCSS_Lost = true;
-        }
-        if (Mask & BK4819_REG_02_CTCSS_FOUND) {
-            g_CTCSS_Lost = false;
-        }
-        if (Mask & BK4819_REG_02_VOX_LOST) {
-            g_VOX_Lost = true;
-            gVoxPauseCountdown = 10;
-            if (gEeprom.VOX_SWITCH) {
-                if (gCurrentFunction == FUNCTION_POWER_SAVE && !gRxIdleMode) {
-                    gBatterySave = 20;
-                    gBatterySaveCountdownExpired = 0;
-                }
-                if (gEeprom.DUAL_WATCH != DUAL_WATCH_OFF &&
-                    (gScheduleDualWatch || gDualWatchCountdown < 20)) {
-                    gDualWatchCountdown = 20;
-                    gScheduleDualWatch = false;
-                }
-            }
-        }
-        if (Mask & BK4819_REG_02_VOX_FOUND) {
-            g_VOX_Lost = false;
-            gVoxPauseCountdown = 0;
-        }
-        if (Mask & BK4819_REG_02_SQUELCH_LOST) {
-            g_SquelchLost = true;
-            BK4819_ToggleGpioOut(BK4819_GPIO0_PIN28_GREEN, true);
-        }
-        if (Mask & BK4819_REG_02_SQUELCH_FOUND) {
-            g_SquelchLost = false;
-            BK4819_ToggleGpioOut(BK4819_GPIO0_PIN28_GREEN, false);
-        }
+// The BK4819 interrupt line is not wired to the MCU, so it is polled from the
+// main loop. While a signal is coming in, being received or scanned for, the
+// interval is short enough to follow the squelch and tones within a couple
+// of ms. Idle in the foreground, during TX and in power save wake windows
+// it stays at the 10ms the time slice used to poll at.
+static void APP_PollRadioInterrupts(void) {
+    uint32_t Timestamp;
+    uint32_t Interval;
+    uint32_t Gap;
+    uint32_t Due;
+
+    if (gCurrentFunction == FUNCTION_POWER_SAVE && gRxIdleMode) {
+        gRadioPollInterval = 0;
+        return;
+    }
+
+    if (gCurrentFunction == FUNCTION_TRANSMIT) {
+        Interval = RADIO_POLL_INTERVAL_TX_US;
+    } else if (gCurrentFunction == FUNCTION_POWER_SAVE) {
+        Interval = RADIO_POLL_INTERVAL_SAVE_US;
+    } else if (gCurrentFunction == FUNCTION_INCOMING ||
+               gCurrentFunction == FUNCTION_RECEIVE ||
+               gCurrentFunction == FUNCTION_MONITOR ||
+               gScanState != SCAN_OFF || gCssScanMode != CSS_SCAN_MODE_OFF) {
+        Interval = RADIO_POLL_INTERVAL_RX_US;
+    } else {
+        Interval = RADIO_POLL_INTERVAL_IDLE_US;
     }
+
+    Timestamp = SYSTICK_GetTimestamp();
+    Gap = Timestamp - gRadioPollTimestamp;
+    if (Gap < Interval) {
+        return;
+    }
+
+    // How long past its due time the poll ran, which is what a blocked main
+    // loop adds to the interrupt latency. After a sleep there is no due time.
+    Due = Interval > gRadioPollInterval ? Interval : gRadioPollInterval;
+    if (gRadioPollInterval && Gap > Due && Gap - Due > gRadioPollLateMaxUs) {
+        gRadioPollLateMaxUs = Gap - Due;
+    }
+    gRadioPollTimestamp = Timestamp;
+    gRadioPollInterval = Interval;
+
+    APP_CheckRadioInterrupts();
 }
 
 void APP_EndTransmission(void) {
@@ -568,6 +651,9 @@ void APP_Update(void) {
     if (gReducedService) {
         return;
     }
+
+    APP_PollRadioInterrupts();
+
     if (gCurrentFunction != FUNCTION_TRANSMIT) {
         APP_HandleFunction();
     }
@@ -600,6 +686,7 @@ void APP_Update(void) {
     }
 
     if (gScreenToDisplay != DISPLAY_SCANNER &&
+        gScreenToDisplay != DISPLAY_SPECTRUM &&
         gEeprom.DUAL_WATCH != DUAL_WATCH_OFF) {
         if (gScheduleDualWatch) {
             if (gScanState == SCAN_OFF && gCssScanMode == CSS_SCAN_MODE_OFF) {
@@ -658,7 +745,7 @@ void APP_Update(void) {
                    gCssScanMode != CSS_SCAN_MODE_OFF || gUpdateRSSI) {
             gCurrentRSSI = BK4819_GetRSSI();
             UI_UpdateRSSI(gCurrentRSSI);
-            gBatterySave = gEeprom.BATTERY_SAVE * 10;
+            gBatterySave = BATTERY_GetSaveTime();
             gRxIdleMode = true;
             BK4819_DisableVox();
             BK4819_Sleep();
@@ -673,35 +760,42 @@ void APP_Update(void) {
     }
 }
 
-void APP_CheckKeys(void) {
+// Debounces the keypad and PTT into events for APP_ProcessKey()
+static void APP_ScanKeys(void) {
+    uint32_t Keys;
     KEY_Code_t Key;
 
+    Keys = KEYBOARD_Scan();
     if (gPttIsPressed) {
-        if (GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_PTT)) {
-            SYSTEM_DelayMs(20);
-            if (GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_PTT)) {
-                APP_ProcessKey(KEY_PTT, false, false);
+        if (!(Keys & KEYBOARD_MASK(KEY_PTT))) {
+            gPttDebounceCounter++;
+            if (gPttDebounceCounter > 1) {
+                KEYBOARD_PushEvent(KEY_PTT, false, false);
                 gPttIsPressed = false;
+                gPttDebounceCounter = 0;
                 if (gKeyReading1 != KEY_INVALID) {
                     gPttWasReleased = true;
                 }
             }
+        } else {
+            gPttDebounceCounter = 0;
         }
     } else {
-        if (!GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_PTT)) {
+        if (Keys & KEYBOARD_MASK(KEY_PTT)) {
             gPttDebounceCounter = gPttDebounceCounter + 1;
             if (gPttDebounceCounter > 4) {
                 gPttIsPressed = true;
-                APP_ProcessKey(KEY_PTT, true, false);
+                gPttDebounceCounter = 0;
+                KEYBOARD_PushEvent(KEY_PTT, true, false);
             }
         } else {
             gPttDebounceCounter = 0;
         }
     }
-    Key = KEYBOARD_Poll();
+    Key = KEYBOARD_GetKey(Keys);
     if (gKeyReading0 != Key) {
         if (gKeyReading0 != KEY_INVALID && Key != KEY_INVALID) {
-            APP_ProcessKey(gKeyReading1, false, gKeyBeingHeld);
+            KEYBOARD_PushEvent(gKeyReading1, false, gKeyBeingHeld);
         }
         gKeyReading0 = Key;
         gDebounceCounter = 0;
@@ -711,25 +805,25 @@ void APP_CheckKeys(void) {
     if (gDebounceCounter == 2) {
         if (Key == KEY_INVALID) {
             if (gKeyReading1 != KEY_INVALID) {
-                APP_ProcessKey(gKeyReading1, false, gKeyBeingHeld);
+                KEYBOARD_PushEvent(gKeyReading1, false, gKeyBeingHeld);
                 gKeyReading1 = KEY_INVALID;
             }
         } else {
             gKeyReading1 = Key;
-            APP_ProcessKey(Key, true, false);
+            KEYBOARD_PushEvent(Key, true, false);
         }
         gKeyBeingHeld = false;
     } else if (gDebounceCounter == 128) {
         if (Key == KEY_STAR || Key == KEY_F || Key == KEY_SIDE2 ||
             Key == KEY_SIDE1 || Key == KEY_UP || Key == KEY_DOWN) {
             gKeyBeingHeld = true;
-            APP_ProcessKey(Key, true, true);
+            KEYBOARD_PushEvent(Key, true, true);
         }
     } else if (gDebounceCounter > 128) {
         if (Key == KEY_UP || Key == KEY_DOWN) {
             gKeyBeingHeld = true;
             if ((gDebounceCounter & 15) == 0) {
-                APP_ProcessKey(Key, true, true);
+                KEYBOARD_PushEvent(Key, true, true);
             }
         }
         if (gDebounceCounter != 0xFFFF) {
@@ -739,21 +833,59 @@ void APP_CheckKeys(void) {
     }
 }
 
+void APP_CheckKeys(void) {
+    KEY_Event_t Event;
+
+    if (UART_GetInjectedKey(&Event.Key, &Event.bKeyPressed, &Event.bKeyHeld)) {
+        // Queued like a scanned key, so both take the same path in order
+        KEYBOARD_PushEvent(Event.Key, Event.bKeyPressed, Event.bKeyHeld);
+        // Reported once the screen shows what the key did
+        gInjectedKeyReport = Event.Key;
+    }
+
+    APP_ScanKeys();
+    while (KEYBOARD_PopEvent(&Event)) {
+        APP_ProcessKey(Event.Key, Event.bKeyPressed, Event.bKeyHeld);
+    }
+}
+
+// The core clock is lowered in power save with the backlight off. Keys and
+// squelch leave power save and restore it here. A UART command restores it
+// before it is handled and keeps it up while the link is active. The UART
+// divisor follows the clock, so it only changes between frames: a frame
+// that woke the radio at 12MHz is received whole at 12MHz.
+static void APP_UpdateClock(void) {
+    if (!UART_IsRxIdle()) {
+        return;
+    }
+    if (gCurrentFunction == FUNCTION_POWER_SAVE && !UART_IsActive() &&
+        !GPIO_CheckBit(&GPIOB->DATA, GPIOB_PIN_BACKLIGHT)) {
+        SYSTEM_SetClockProfile(SYSTEM_CLOCK_PROFILE_12MHZ);
+    } else {
+        SYSTEM_SetClockProfile(SYSTEM_CLOCK_PROFILE_48MHZ);
+    }
+}
+
 void APP_TimeSlice10ms(void) {
     gFlashLightBlinkCounter++;
+    ENERGY_TimeSlice10ms();
 
+    UART_TimeSlice10ms();
     if (UART_IsCommandAvailable()) {
-        __disable_irq();
+        // The divisor changes with the clock, so the reply must not start
+        // at 12MHz and finish at 48MHz
+        SYSTEM_SetClockProfile(SYSTEM_CLOCK_PROFILE_48MHZ);
         UART_HandleCommand();
-        __enable_irq();
     }
+    APP_UpdateClock();
 
     if (gReducedService) {
         return;
     }
 
-    if (gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode) {
-        APP_CheckRadioInterrupts();
+    if (gScreenToDisplay == DISPLAY_SPECTRUM &&
+        gCurrentFunction != FUNCTION_TRANSMIT) {
+        SPECTRUM_TimeSlice10ms();
     }
 
     if (gCurrentFunction != FUNCTION_TRANSMIT) {
@@ -767,6 +899,13 @@ void APP_TimeSlice10ms(void) {
         }
     }
 
+    // Keys are handled at the end of the slice, so this is the first redraw
+    // after the last injected one
+    if (gInjectedKeyReport != KEY_INVALID) {
+        UART_ReportInjectedKey(gInjectedKeyReport);
+        gInjectedKeyReport = KEY_INVALID;
+    }
+
     // Skipping authentic device checks
 
 
@@ -948,17 +1087,13 @@ void APP_TimeSlice500ms(void) {
 
     gBatteryCheckCounter++;
 
+    ACTIVITY_TimeSlice500ms();
+
     // Skipped authentic device check
 
     if (gCurrentFunction != FUNCTION_TRANSMIT) {
-        if ((gBatteryCheckCounter & 1) == 0) {
-            BOARD_ADC_GetBatteryInfo(&gBatteryVoltages[gBatteryVoltageIndex++],
-                                     &gBatteryCurrent);
-            if (gBatteryVoltageIndex > 3) {
-                gBatteryVoltageIndex = 0;
-            }
-            BATTERY_GetReadings(true);
-        }
+        BATTERY_Sample();
+        BATTERY_GetReadings(true);
 
         if (gCurrentFunction != FUNCTION_POWER_SAVE) {
             gCurrentRSSI = BK4819_GetRSSI();
@@ -973,7 +1108,8 @@ void APP_TimeSlice500ms(void) {
                 }
           //  }
             if ((gScreenToDisplay != DISPLAY_SCANNER ||
-                 (gScanCssState >= SCAN_CSS_STATE_FOUND))) {
+                 (gScanCssState >= SCAN_CSS_STATE_FOUND)) &&
+                gScreenToDisplay != DISPLAY_SPECTRUM) {
                 if (gEeprom.AUTO_KEYPAD_LOCK && gKeyLockCountdown &&
                     !gDTMF_InputMode) {
                     gKeyLockCountdown--;
@@ -1080,8 +1216,7 @@ void APP_TimeSlice500ms(void) {
     if (gDTMF_RecvTimeout) {
         gDTMF_RecvTimeout--;
         if (gDTMF_RecvTimeout == 0) {
-            gDTMF_WriteIndex = 0;
-            memset(gDTMF_Received, 0, sizeof(gDTMF_Received));
+            DTMF_ClearReceived();
         }
     }
     gUpdateStatus = true;
@@ -1106,6 +1241,7 @@ void CHANNEL_Next(bool bFlag, int8_t Direction) {
     gNextMrChannel = gRxVfo->CHANNEL_SAVE;
     gCurrentScanList = 0;
     gScanState = Direction;
+    gScanResumeFrequency = 0;
     if (IS_MR_CHANNEL(gNextMrChannel)) {
         if (bFlag) {
             gRestoreMrChannel = gNextMrChannel;
@@ -1350,10 +1486,14 @@ static void APP_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
                 case DISPLAY_SCANNER:
                     SCANNER_ProcessKeys(Key, bKeyPressed, bKeyHeld);
                     break;
+                case DISPLAY_SPECTRUM:
+                    SPECTRUM_ProcessKeys(Key, bKeyPressed, bKeyHeld);
+                    break;
                 default:
                     break;
             }
-        } else if (gScreenToDisplay != DISPLAY_SCANNER) {
+        } else if (gScreenToDisplay != DISPLAY_SCANNER &&
+                   gScreenToDisplay != DISPLAY_SPECTRUM) {
             ACTION_Handle(Key, bKeyPressed, bKeyHeld);
         } else if (!bKeyHeld && bKeyPressed) {
             gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
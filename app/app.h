@@ -21,6 +21,12 @@
 #include "functions.h"
 #include "radio.h"
 
+// The last BK4819 interrupt and the longest a radio poll ran late, both are
+// reported over telemetry
+extern uint16_t gRadioInterruptMask;
+extern uint32_t gRadioInterruptTimestamp;
+extern uint32_t gRadioPollLateMaxUs;
+
 void APP_EndTransmission(void);
 void CHANNEL_Next(bool bFlag, int8_t Direction);
 void APP_StartListening(FUNCTION_Type_t Function);
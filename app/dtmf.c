@@ -51,6 +51,45 @@ bool gDTMF_IsTx;
 uint8_t gDTMF_TxStopCountdown;
 bool gDTMF_IsGroupCall;
 
+#define DTMF_RX_MASK (sizeof(gDTMF_Received) - 1U)
+
+// Received digits are matched with a shift-and automaton per pattern: bit i
+// of State is set when the last i + 1 digits match the first i + 1 pattern
+// positions, so every digit costs the same whatever the buffer holds.
+// ExactState tracks the same without the group call wildcard.
+typedef struct {
+	uint16_t Accept[16];
+	uint16_t GroupExact;
+	uint16_t Final;
+	uint16_t State;
+	uint16_t ExactState;
+} DTMF_Pattern_t;
+
+enum {
+	DTMF_PATTERN_AB = 0U,
+	DTMF_PATTERN_RESPONSE,
+	DTMF_PATTERN_ID,
+	DTMF_PATTERN_COUNT,
+};
+
+static DTMF_Pattern_t Patterns[DTMF_PATTERN_COUNT];
+static uint8_t GroupCallCode;
+static uint8_t Matches;
+
+#define DTMF_CONTACT_COUNT	16U
+#define DTMF_NAME_CACHE_SIZE	2U
+
+typedef struct {
+	uint8_t Index;
+	char Name[8];
+} DTMF_ContactName_t;
+
+static char ContactIDs[DTMF_CONTACT_COUNT][3];
+static uint16_t ValidContacts;
+static uint16_t StaleContacts;
+static DTMF_ContactName_t NameCache[DTMF_NAME_CACHE_SIZE];
+static uint8_t NameCacheNext;
+
 bool DTMF_ValidateCodes(char *pCode, uint8_t Size)
 {
 	uint8_t i;
@@ -72,32 +111,109 @@ bool DTMF_ValidateCodes(char *pCode, uint8_t Size)
 	return true;
 }
 
+// Contacts are 16 byte records at 0x1C00: 8 byte name then the 3 digit ID.
+// Only the IDs are kept in RAM, names are read on demand into a small cache
+// so screen redraws during a call do not go back to the EEPROM.
+static void DTMF_RefreshContacts(void)
+{
+	uint8_t i;
+
+	if (StaleContacts == 0) {
+		return;
+	}
+
+	for (i = 0; i < DTMF_CONTACT_COUNT; i++) {
+		char Contact[11];
+
+		if ((StaleContacts & (1U << i)) == 0) {
+			continue;
+		}
+		EEPROM_ReadBuffer(0x1C00 + (i * 0x10), Contact, sizeof(Contact));
+		if (Contact[0] < ' ' || Contact[0] > 0x7E) {
+			ValidContacts &= ~(1U << i);
+		} else {
+			ValidContacts |= 1U << i;
+			memcpy(ContactIDs[i], Contact + 8, 3);
+		}
+	}
+	StaleContacts = 0;
+}
+
+static const char *DTMF_GetContactName(uint8_t Index)
+{
+	DTMF_ContactName_t *pName;
+	uint8_t i;
+
+	for (i = 0; i < DTMF_NAME_CACHE_SIZE; i++) {
+		if (NameCache[i].Index == Index) {
+			return NameCache[i].Name;
+		}
+	}
+
+	pName = &NameCache[NameCacheNext];
+	NameCacheNext = (NameCacheNext + 1) % DTMF_NAME_CACHE_SIZE;
+	EEPROM_ReadBuffer(0x1C00 + (Index * 0x10), pName->Name, sizeof(pName->Name));
+	pName->Index = Index;
+
+	return pName->Name;
+}
+
+void DTMF_LoadContacts(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < DTMF_NAME_CACHE_SIZE; i++) {
+		NameCache[i].Index = 0xFF;
+	}
+	StaleContacts = 0xFFFF;
+	DTMF_RefreshContacts();
+}
+
+void DTMF_InvalidateContact(uint8_t Index)
+{
+	uint8_t i;
+
+	if (Index >= DTMF_CONTACT_COUNT) {
+		return;
+	}
+
+	for (i = 0; i < DTMF_NAME_CACHE_SIZE; i++) {
+		if (NameCache[i].Index == Index) {
+			NameCache[i].Index = 0xFF;
+		}
+	}
+	StaleContacts |= 1U << Index;
+}
+
 bool DTMF_GetContact(uint8_t Index, char *pContact)
 {
-	EEPROM_ReadBuffer(0x1C00 + (Index * 0x10), pContact, 16);
-	if (pContact[0] < ' ' || pContact[0] > 0x7E) {
+	DTMF_RefreshContacts();
+	if (Index >= DTMF_CONTACT_COUNT || (ValidContacts & (1U << Index)) == 0) {
 		return false;
 	}
 
+	memcpy(pContact, DTMF_GetContactName(Index), 8);
+	memcpy(pContact + 8, ContactIDs[Index], 3);
+
 	return true;
 }
 
 bool DTMF_FindContact(const char *pContact, char *pResult)
 {
-	char Contact [16];
 	uint8_t i, j;
 
-	for (i = 0; i < 16; i++) {
-		if (!DTMF_GetContact(i, Contact)) {
+	DTMF_RefreshContacts();
+	for (i = 0; i < DTMF_CONTACT_COUNT; i++) {
+		if ((ValidContacts & (1U << i)) == 0) {
 			return false;
 		}
 		for (j = 0; j < 3; j++) {
-			if (pContact[j] != Contact[j + 8]) {
+			if (pContact[j] != ContactIDs[i][j]) {
 				break;
 			}
 		}
 		if (j == 3) {
-			memcpy(pResult, Contact, 8);
+			memcpy(pResult, DTMF_GetContactName(i), 8);
 			pResult[8] = 0;
 			return true;
 		}
@@ -130,36 +246,121 @@ char DTMF_GetCharacter(uint8_t Code)
 	return 0xFF;
 }
 
-bool DTMF_CompareMessage(const char *pMsg, const char *pTemplate, uint8_t Size, bool bCheckGroup)
+bool DTMF_CheckGroupCall(const char *pMsg, uint32_t Size)
 {
-	uint8_t i;
+	uint32_t i;
 
 	for (i = 0; i < Size; i++) {
-		if (pMsg[i] != pTemplate[i]) {
-			if (!bCheckGroup || pMsg[i] != gEeprom.DTMF_GROUP_CALL_CODE) {
-				return false;
+		if (pMsg[i] == gEeprom.DTMF_GROUP_CALL_CODE) {
+			break;
+		}
+	}
+	if (i != Size) {
+		return true;
+	}
+
+	return false;
+}
+
+// Positions past Size accept any digit
+static void DTMF_SetupPattern(DTMF_Pattern_t *pPattern, const char *pTemplate, uint8_t Size, uint8_t Any, bool bCheckGroup)
+{
+	uint8_t i;
+	uint8_t Code;
+
+	memset(pPattern, 0, sizeof(*pPattern));
+	for (i = 0; i < Size + Any; i++) {
+		const uint16_t Bit = 1U << i;
+
+		for (Code = 0; Code < 16; Code++) {
+			if (i >= Size || DTMF_GetCharacter(Code) == pTemplate[i]) {
+				pPattern->Accept[Code] |= Bit;
+				if (Code == GroupCallCode) {
+					pPattern->GroupExact |= Bit;
+				}
+			} else if (bCheckGroup && Code == GroupCallCode) {
+				pPattern->Accept[Code] |= Bit;
 			}
-			gDTMF_IsGroupCall = true;
 		}
 	}
+	pPattern->Final = 1U << (Size + Any - 1);
+}
 
-	return true;
+static bool DTMF_StepPattern(DTMF_Pattern_t *pPattern, uint8_t Code)
+{
+	pPattern->State = ((pPattern->State << 1) | 1U) & pPattern->Accept[Code];
+	if (Code == GroupCallCode) {
+		pPattern->ExactState = ((pPattern->ExactState << 1) | 1U) & pPattern->GroupExact;
+	} else {
+		pPattern->ExactState = ((pPattern->ExactState << 1) | 1U) & pPattern->Accept[Code];
+	}
+
+	return (pPattern->State & pPattern->Final) != 0;
 }
 
-bool DTMF_CheckGroupCall(const char *pMsg, uint32_t Size)
+static void DTMF_CopyReceived(char *pOutput, uint8_t Age, uint8_t Size)
 {
-	uint32_t i;
+	uint8_t Index;
 
-	for (i = 0; i < Size; i++) {
-		if (pMsg[i] == gEeprom.DTMF_GROUP_CALL_CODE) {
-			break;
+	Index = gDTMF_WriteIndex - Age;
+	while (Size--) {
+		*pOutput++ = gDTMF_Received[Index++ & DTMF_RX_MASK];
+	}
+}
+
+// Must be called whenever the ANI ID, the separator or group codes, or the
+// outgoing call ID change.
+void DTMF_SetupMatcher(void)
+{
+	char String[20];
+	uint8_t Code;
+
+	GroupCallCode = 0xFF;
+	for (Code = 0; Code < 16; Code++) {
+		if (DTMF_GetCharacter(Code) == gEeprom.DTMF_GROUP_CALL_CODE) {
+			GroupCallCode = Code;
 		}
 	}
-	if (i != Size) {
-		return true;
+
+	DTMF_SetupPattern(&Patterns[DTMF_PATTERN_AB], "AB", 2, 0, true);
+
+	// Only the first 9 characters are matched, gDTMF_String can hold 14
+	snprintf(String, sizeof(String), "%s%c%s", gDTMF_String, gEeprom.DTMF_SEPARATE_CODE, "AAAAA");
+	DTMF_SetupPattern(&Patterns[DTMF_PATTERN_RESPONSE], String, 9, 0, false);
+
+	// Callee ID, separator and the 3 digit caller ID
+	snprintf(String, sizeof(String), "%s%c", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE);
+	DTMF_SetupPattern(&Patterns[DTMF_PATTERN_ID], String, 4, 3, true);
+
+	DTMF_ClearReceived();
+}
+
+void DTMF_ClearReceived(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < DTMF_PATTERN_COUNT; i++) {
+		Patterns[i].State = 0;
+		Patterns[i].ExactState = 0;
 	}
+	Matches = 0;
+	gDTMF_WriteIndex = 0;
+	memset(gDTMF_Received, 0, sizeof(gDTMF_Received));
+}
 
-	return false;
+void DTMF_Receive(uint8_t Code)
+{
+	uint8_t i;
+
+	Code &= 0x0F;
+	gDTMF_Received[gDTMF_WriteIndex++ & DTMF_RX_MASK] = DTMF_GetCharacter(Code);
+
+	Matches = 0;
+	for (i = 0; i < DTMF_PATTERN_COUNT; i++) {
+		if (DTMF_StepPattern(&Patterns[i], Code)) {
+			Matches |= 1U << i;
+		}
+	}
 }
 
 void DTMF_Append(char Code)
@@ -175,9 +376,6 @@ void DTMF_Append(char Code)
 
 void DTMF_HandleRequest(void)
 {
-	char String[20];
-	uint8_t Offset;
-
 	if (!gDTMF_RequestPending) {
 		return;
 	}
@@ -192,63 +390,51 @@ void DTMF_HandleRequest(void)
 		return;
 	}
 
-	if (gDTMF_WriteIndex >= 9) {
-        return;
-	}
-
-	if (gDTMF_WriteIndex >= 2) {
-		if (DTMF_CompareMessage(gDTMF_Received + (gDTMF_WriteIndex - 2), "AB", 2, true)) {
-			gDTMF_State = DTMF_STATE_TX_SUCC;
-			gUpdateDisplay = true;
-			return;
-		}
+	if (Matches & (1U << DTMF_PATTERN_AB)) {
+		gDTMF_State = DTMF_STATE_TX_SUCC;
+		gUpdateDisplay = true;
+		return;
 	}
 
-	if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT && gDTMF_CallMode == DTMF_CALL_MODE_NOT_GROUP && gDTMF_WriteIndex >= 9) {
-		Offset = gDTMF_WriteIndex - 9;
-		sprintf(String, "%s%c%s", gDTMF_String, gEeprom.DTMF_SEPARATE_CODE, "AAAAA");
-		if (DTMF_CompareMessage(gDTMF_Received + Offset, String, 9, false)) {
-			gDTMF_State = DTMF_STATE_CALL_OUT_RSP;
-			gUpdateDisplay = true;
-		}
+	if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT && gDTMF_CallMode == DTMF_CALL_MODE_NOT_GROUP && (Matches & (1U << DTMF_PATTERN_RESPONSE))) {
+		gDTMF_State = DTMF_STATE_CALL_OUT_RSP;
+		gUpdateDisplay = true;
 	}
 
 	if (gDTMF_CallState != DTMF_CALL_STATE_NONE) {
 		return;
 	}
 
-	if (gDTMF_WriteIndex >= 7) {
-		Offset = gDTMF_WriteIndex - 7;
-		sprintf(String, "%s%c", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE);
-		gDTMF_IsGroupCall = false;
-		if (DTMF_CompareMessage(gDTMF_Received + Offset, String, 4, true)) {
-			gDTMF_CallState = DTMF_CALL_STATE_RECEIVED;
-			memcpy(gDTMF_Callee, gDTMF_Received + Offset, 3);
-			memcpy(gDTMF_Caller, gDTMF_Received + Offset + 4, 3);
-
-			gUpdateDisplay = true;
-
-			switch (gEeprom.DTMF_DECODE_RESPONSE) {
-			case 3:
-				gDTMF_DecodeRing = true;
-				gDTMF_DecodeRingCountdown = 20;
-				// Fallthrough
-			case 2:
-				gDTMF_ReplyState = DTMF_REPLY_AAAAA;
-				break;
-			case 1:
-				gDTMF_DecodeRing = true;
-				gDTMF_DecodeRingCountdown = 20;
-				break;
-			default:
-				gDTMF_DecodeRing = false;
-				gDTMF_ReplyState = DTMF_REPLY_NONE;
-				break;
-			}
+	if (Matches & (1U << DTMF_PATTERN_ID)) {
+		const DTMF_Pattern_t *pPattern = &Patterns[DTMF_PATTERN_ID];
 
-			if (gDTMF_IsGroupCall) {
-				gDTMF_ReplyState = DTMF_REPLY_NONE;
-			}
+		gDTMF_IsGroupCall = (pPattern->ExactState & pPattern->Final) == 0;
+		gDTMF_CallState = DTMF_CALL_STATE_RECEIVED;
+		DTMF_CopyReceived(gDTMF_Callee, 7, 3);
+		DTMF_CopyReceived(gDTMF_Caller, 3, 3);
+
+		gUpdateDisplay = true;
+
+		switch (gEeprom.DTMF_DECODE_RESPONSE) {
+		case 3:
+			gDTMF_DecodeRing = true;
+			gDTMF_DecodeRingCountdown = 20;
+			// Fallthrough
+		case 2:
+			gDTMF_ReplyState = DTMF_REPLY_AAAAA;
+			break;
+		case 1:
+			gDTMF_DecodeRing = true;
+			gDTMF_DecodeRingCountdown = 20;
+			break;
+		default:
+			gDTMF_DecodeRing = false;
+			gDTMF_ReplyState = DTMF_REPLY_NONE;
+			break;
+		}
+
+		if (gDTMF_IsGroupCall) {
+			gDTMF_ReplyState = DTMF_REPLY_NONE;
 		}
 	}
 }
@@ -77,12 +77,16 @@ extern bool gDTMF_IsTx;
 extern uint8_t gDTMF_TxStopCountdown;
 
 bool DTMF_ValidateCodes(char *pCode, uint8_t Size);
+void DTMF_LoadContacts(void);
+void DTMF_InvalidateContact(uint8_t Index);
 bool DTMF_GetContact(uint8_t Index, char *pContact);
 bool DTMF_FindContact(const char *pContact, char *pResult);
 char DTMF_GetCharacter(uint8_t Code);
-bool DTMF_CompareMessage(const char *pDTMF, const char *pTemplate, uint8_t Size, bool bFlag);
 bool DTMF_CheckGroupCall(const char *pDTMF, uint32_t Size);
 void DTMF_Append(char Code);
+void DTMF_SetupMatcher(void);
+void DTMF_ClearReceived(void);
+void DTMF_Receive(uint8_t Code);
 void DTMF_HandleRequest(void);
 void DTMF_Reply(void);
 
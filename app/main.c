@@ -19,9 +19,11 @@
 #include <string.h>
 
 #include "app/action.h"
+#include "app/activity.h"
 #include "app/app.h"
 #include "app/generic.h"
 #include "app/scanner.h"
+#include "app/spectrum.h"
 #include "app/menu.h"
 #include "audio.h"
 #include "dtmf.h"
@@ -153,8 +155,7 @@ static void MAIN_Key_DIGITS(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld) {
             break;
 
         case KEY_5:
-            //APP_RunSpectrum();
-            gRequestDisplayScreen = DISPLAY_MAIN;
+            SPECTRUM_Start();
             break;
 
         case KEY_6:
@@ -249,6 +250,13 @@ static void MAIN_Key_STAR(bool bKeyPressed, bool bKeyHeld) {
             gRequestDisplayScreen = DISPLAY_MAIN;
             return;
         }
+        // Short press while scanning toggles the activity biased scan
+        gActivityScanEnabled = !gActivityScanEnabled;
+        if (gActivityScanEnabled) {
+            gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
+        } else {
+            gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
+        }
     } else {
         gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
         if (!gWasFKeyPressed) {
@@ -124,6 +124,9 @@ int MENU_GetLimits(uint8_t Cursor, uint8_t *pMin, uint8_t *pMax) {
             *pMax = 199;
             break;
         case MENU_SAVE:
+            *pMin = 0;
+            *pMax = 5;
+            break;
         case MENU_MIC:
             *pMin = 0;
             *pMax = 4;
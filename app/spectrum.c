@@ -0,0 +1,346 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+#include "app/spectrum.h"
+#include "audio.h"
+#include "bsp/dp32g030/gpio.h"
+#include "driver/bk4819.h"
+#include "driver/gpio.h"
+#include "driver/systick.h"
+#include "frequencies.h"
+#include "functions.h"
+#include "misc.h"
+#include "radio.h"
+#include "ui/spectrum.h"
+#include "ui/ui.h"
+
+// The settle delays of a 10ms slice add up to at most SPECTRUM_SLICE_US,
+// which keeps the keypad and UART responsive at long settle times
+#define SPECTRUM_SLICE_US		5000U
+#define SPECTRUM_POINTS_PER_SLICE	16U
+
+#define SPECTRUM_SETTLE_MIN		200U
+#define SPECTRUM_SETTLE_MAX		3000U
+#define SPECTRUM_SETTLE_STEP		100U
+
+static const uint16_t StepOptions[] = { 250, 625, 1250, 2500, 5000, 10000 };
+
+// PLL lock time grows with the size of the hop
+static const uint16_t SettleOptions[] = { 600, 600, 700, 800, 1000, 1200 };
+
+uint32_t gSpectrumCenter;
+uint16_t gSpectrumStep;
+uint16_t gSpectrumSettleUs;
+uint16_t gSpectrumRate;
+uint16_t gSpectrumSweepCount;
+uint8_t gSpectrumRSSI[SPECTRUM_POINTS];
+uint8_t gSpectrumPeak[SPECTRUM_POINTS];
+uint8_t gSpectrumWaterfallCount;
+
+static uint8_t Waterfall[SPECTRUM_WATERFALL_ROWS][SPECTRUM_WATERFALL_ROW_SIZE];
+static uint8_t WaterfallHead;
+
+static uint8_t StepIndex;
+static uint8_t PointIndex;
+static uint16_t RegHigh;
+static uint16_t Reg30;
+static bool bLowPath;
+static uint16_t RatePoints;
+static uint32_t RateStart;
+
+static void SPECTRUM_Restart(void)
+{
+	uint32_t Lower = LowerLimitFrequencyBandTable[0] + (SPECTRUM_POINTS / 2) * gSpectrumStep;
+	uint32_t Upper = UpperLimitFrequencyBandTable[6] - (SPECTRUM_POINTS / 2) * gSpectrumStep;
+
+	if (gSpectrumCenter < Lower) {
+		gSpectrumCenter = Lower;
+	}
+	if (gSpectrumCenter > Upper) {
+		gSpectrumCenter = Upper;
+	}
+	memset(gSpectrumRSSI, 0, sizeof(gSpectrumRSSI));
+	memset(gSpectrumPeak, 0, sizeof(gSpectrumPeak));
+	gSpectrumWaterfallCount = 0;
+	PointIndex = 0;
+	gUpdateDisplay = true;
+}
+
+static void SPECTRUM_SelectStep(uint8_t Index)
+{
+	StepIndex = Index;
+	gSpectrumStep = StepOptions[Index];
+	gSpectrumSettleUs = SettleOptions[Index];
+	SPECTRUM_Restart();
+}
+
+// Only REG_38 changes between adjacent points in most sweeps, so REG_39 is
+// written when its word differs and the filter path only when crossing 28MHz.
+static void SPECTRUM_Tune(uint32_t Frequency)
+{
+	const uint16_t High = (Frequency >> 16) & 0xFFFF;
+	const bool bLow = Frequency < 28000000;
+
+	BK4819_WriteRegister(BK4819_REG_38, Frequency & 0xFFFF);
+	if (High != RegHigh) {
+		BK4819_WriteRegister(BK4819_REG_39, High);
+		RegHigh = High;
+	}
+	if (bLow != bLowPath) {
+		BK4819_PickRXFilterPathBasedOnFrequency(Frequency);
+		bLowPath = bLow;
+	}
+	// Restart the VCO calibration so the PLL locks onto the new frequency
+	BK4819_WriteRegister(BK4819_REG_30, 0);
+	BK4819_WriteRegister(BK4819_REG_30, Reg30);
+}
+
+// Levels are relative to the quietest point of the sweep so the waterfall
+// follows the noise floor across bands.
+static void SPECTRUM_PushWaterfallRow(void)
+{
+	uint8_t *pRow;
+	uint8_t Floor;
+	uint8_t i;
+
+	Floor = 0xFF;
+	for (i = 0; i < SPECTRUM_POINTS; i++) {
+		if (gSpectrumRSSI[i] < Floor) {
+			Floor = gSpectrumRSSI[i];
+		}
+	}
+
+	WaterfallHead = (WaterfallHead + 1) % SPECTRUM_WATERFALL_ROWS;
+	pRow = Waterfall[WaterfallHead];
+	memset(pRow, 0, SPECTRUM_WATERFALL_ROW_SIZE);
+	for (i = 0; i < SPECTRUM_POINTS; i++) {
+		const uint8_t Delta = gSpectrumRSSI[i] - Floor;
+		uint8_t Level;
+
+		if (Delta >= 18) {
+			Level = 3;
+		} else if (Delta >= 9) {
+			Level = 2;
+		} else if (Delta >= 4) {
+			Level = 1;
+		} else {
+			continue;
+		}
+		pRow[i / 4] |= Level << ((i & 3) * 2);
+	}
+
+	if (gSpectrumWaterfallCount < SPECTRUM_WATERFALL_ROWS) {
+		gSpectrumWaterfallCount++;
+	}
+}
+
+static void SPECTRUM_Key_STEP(bool bKeyPressed, bool bKeyHeld, int8_t Direction)
+{
+	if (bKeyHeld || !bKeyPressed) {
+		return;
+	}
+	if ((Direction > 0 && StepIndex + 1U >= sizeof(StepOptions) / sizeof(StepOptions[0])) || (Direction < 0 && StepIndex == 0)) {
+		gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
+		return;
+	}
+	gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
+	SPECTRUM_SelectStep(StepIndex + Direction);
+}
+
+static void SPECTRUM_Key_SETTLE(bool bKeyPressed, bool bKeyHeld, int8_t Direction)
+{
+	if (!bKeyPressed) {
+		return;
+	}
+	if (Direction > 0 && gSpectrumSettleUs < SPECTRUM_SETTLE_MAX) {
+		gSpectrumSettleUs += SPECTRUM_SETTLE_STEP;
+	} else if (Direction < 0 && gSpectrumSettleUs > SPECTRUM_SETTLE_MIN) {
+		gSpectrumSettleUs -= SPECTRUM_SETTLE_STEP;
+	} else if (!bKeyHeld) {
+		gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
+		return;
+	}
+	if (!bKeyHeld) {
+		gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
+	}
+	gUpdateDisplay = true;
+}
+
+static void SPECTRUM_Key_UP_DOWN(bool bKeyPressed, int8_t Direction)
+{
+	if (!bKeyPressed) {
+		return;
+	}
+	if (Direction > 0) {
+		gSpectrumCenter += (SPECTRUM_POINTS / 4) * gSpectrumStep;
+	} else {
+		gSpectrumCenter -= (SPECTRUM_POINTS / 4) * gSpectrumStep;
+	}
+	SPECTRUM_Restart();
+}
+
+void SPECTRUM_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
+{
+	switch (Key) {
+	case KEY_1:
+		SPECTRUM_Key_STEP(bKeyPressed, bKeyHeld, 1);
+		break;
+	case KEY_7:
+		SPECTRUM_Key_STEP(bKeyPressed, bKeyHeld, -1);
+		break;
+	case KEY_3:
+		SPECTRUM_Key_SETTLE(bKeyPressed, bKeyHeld, 1);
+		break;
+	case KEY_9:
+		SPECTRUM_Key_SETTLE(bKeyPressed, bKeyHeld, -1);
+		break;
+	case KEY_UP:
+		SPECTRUM_Key_UP_DOWN(bKeyPressed, 1);
+		break;
+	case KEY_DOWN:
+		SPECTRUM_Key_UP_DOWN(bKeyPressed, -1);
+		break;
+	case KEY_STAR:
+		if (!bKeyHeld && bKeyPressed) {
+			gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
+			memset(gSpectrumPeak, 0, sizeof(gSpectrumPeak));
+			gUpdateDisplay = true;
+		}
+		break;
+	case KEY_EXIT:
+		if (!bKeyHeld && bKeyPressed) {
+			gBeepToPlay = BEEP_1KHZ_60MS_OPTIONAL;
+			SPECTRUM_Stop();
+		}
+		break;
+	case KEY_PTT:
+		if (bKeyPressed) {
+			SPECTRUM_Stop();
+			gPttIsPressed = false;
+			gPttDebounceCounter = 0;
+		}
+		break;
+	default:
+		if (!bKeyHeld && bKeyPressed) {
+			gBeepToPlay = BEEP_500HZ_60MS_DOUBLE_BEEP_OPTIONAL;
+		}
+		break;
+	}
+}
+
+void SPECTRUM_Start(void)
+{
+	uint8_t i;
+
+	if (gCurrentFunction != FUNCTION_FOREGROUND) {
+		FUNCTION_Select(FUNCTION_FOREGROUND);
+	}
+	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
+	gEnableSpeaker = false;
+	BK4819_SetAF(BK4819_AF_MUTE);
+	BK4819_ToggleGpioOut(BK4819_GPIO0_PIN28_GREEN, false);
+
+	gSpectrumCenter = gRxVfo->pCurrent->Frequency;
+	for (i = 0; i < sizeof(StepOptions) / sizeof(StepOptions[0]) - 1; i++) {
+		if (StepOptions[i] >= gRxVfo->StepFrequency) {
+			break;
+		}
+	}
+	SPECTRUM_SelectStep(i);
+
+	Reg30 = BK4819_GetRegister(BK4819_REG_30);
+	RegHigh = BK4819_GetRegister(BK4819_REG_39);
+	bLowPath = gSpectrumCenter < 28000000;
+	BK4819_PickRXFilterPathBasedOnFrequency(gSpectrumCenter);
+
+	gSpectrumRate = 0;
+	gSpectrumSweepCount = 0;
+	RatePoints = 0;
+	RateStart = gGlobalSysTickCounter;
+	gRequestDisplayScreen = DISPLAY_SPECTRUM;
+}
+
+void SPECTRUM_Stop(void)
+{
+	RADIO_SetupRegisters(true);
+	gUpdateStatus = true;
+	gRequestDisplayScreen = DISPLAY_MAIN;
+}
+
+void SPECTRUM_TimeSlice10ms(void)
+{
+	const uint32_t Start = gSpectrumCenter - (SPECTRUM_POINTS / 2) * gSpectrumStep;
+	uint16_t Points = SPECTRUM_SLICE_US / gSpectrumSettleUs;
+	uint32_t Elapsed;
+	uint8_t i;
+
+	if (Points == 0) {
+		Points = 1;
+	} else if (Points > SPECTRUM_POINTS_PER_SLICE) {
+		Points = SPECTRUM_POINTS_PER_SLICE;
+	}
+
+	for (i = 0; i < Points; i++) {
+		uint8_t Level;
+
+		SPECTRUM_Tune(Start + PointIndex * gSpectrumStep);
+		SYSTICK_DelayUs(gSpectrumSettleUs);
+
+		// REG_67 is in 0.5dB units, whole dB is plenty for the scope
+		Level = (BK4819_GetRSSI() >> 1) & 0xFF;
+		gSpectrumRSSI[PointIndex] = Level;
+		if (Level > gSpectrumPeak[PointIndex]) {
+			gSpectrumPeak[PointIndex] = Level;
+		}
+
+		if (++PointIndex == SPECTRUM_POINTS) {
+			uint8_t j;
+
+			PointIndex = 0;
+			gSpectrumSweepCount++;
+			if ((gSpectrumSweepCount & 3) == 0) {
+				for (j = 0; j < SPECTRUM_POINTS; j++) {
+					if (gSpectrumPeak[j] > gSpectrumRSSI[j]) {
+						gSpectrumPeak[j]--;
+					}
+				}
+			}
+			SPECTRUM_PushWaterfallRow();
+			UI_UpdateSpectrum();
+			i++;
+			break;
+		}
+	}
+
+	RatePoints += i;
+	Elapsed = gGlobalSysTickCounter - RateStart;
+	if (Elapsed >= 100) {
+		gSpectrumRate = (RatePoints * 100U) / Elapsed;
+		RatePoints = 0;
+		RateStart = gGlobalSysTickCounter;
+	}
+}
+
+const uint8_t *SPECTRUM_GetWaterfallRow(uint8_t Age)
+{
+	if (Age >= gSpectrumWaterfallCount) {
+		return NULL;
+	}
+
+	return Waterfall[(WaterfallHead + SPECTRUM_WATERFALL_ROWS - Age) % SPECTRUM_WATERFALL_ROWS];
+}
+
@@ -0,0 +1,46 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef APP_SPECTRUM_H
+#define APP_SPECTRUM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driver/keyboard.h"
+
+#define SPECTRUM_POINTS 128U
+
+// 2 bits per column, newest row first
+#define SPECTRUM_WATERFALL_ROWS 48U
+#define SPECTRUM_WATERFALL_ROW_SIZE (SPECTRUM_POINTS / 4U)
+
+extern uint32_t gSpectrumCenter;
+extern uint16_t gSpectrumStep;
+extern uint16_t gSpectrumSettleUs;
+extern uint16_t gSpectrumRate;
+extern uint16_t gSpectrumSweepCount;
+extern uint8_t gSpectrumRSSI[SPECTRUM_POINTS];
+extern uint8_t gSpectrumPeak[SPECTRUM_POINTS];
+extern uint8_t gSpectrumWaterfallCount;
+
+void SPECTRUM_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
+void SPECTRUM_Start(void);
+void SPECTRUM_Stop(void);
+void SPECTRUM_TimeSlice10ms(void);
+const uint8_t *SPECTRUM_GetWaterfallRow(uint8_t Age);
+
+#endif
+
@@ -15,8 +15,13 @@
  */
 
 #include <string.h>
+#include "app/activity.h"
+#include "app/app.h"
+#include "app/dtmf.h"
+#include "app/spectrum.h"
 #include "app/uart.h"
 #include "board.h"
+#include "bsp/dp32g030/crc.h"
 #include "bsp/dp32g030/dma.h"
 #include "bsp/dp32g030/gpio.h"
 #include "driver/aes.h"
@@ -24,11 +29,17 @@
 #include "driver/crc.h"
 #include "driver/eeprom.h"
 #include "driver/gpio.h"
+#include "driver/st7565.h"
+#include "driver/systick.h"
 #include "driver/uart.h"
 #include "functions.h"
+#include "helper/battery.h"
+#include "helper/energy.h"
 #include "misc.h"
+#include "radio.h"
 #include "settings.h"
 #include "sram-overlay.h"
+#include "ui/ui.h"
 #include "version.h"
 
 #define DMA_INDEX(x, y) (((x) + (y)) % sizeof(UART_DMA_Buffer))
@@ -128,10 +139,239 @@ typedef struct {
 	uint32_t Timestamp;
 } CMD_052F_t;
 
-static const uint8_t Obfuscation[16] = { 0x16, 0x6C, 0x14, 0xE6, 0x2E, 0x91, 0x0D, 0x40, 0x21, 0x35, 0xD5, 0x40, 0x13, 0x03, 0xE9, 0x80 };
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Center;
+		uint16_t Step;
+		uint16_t SettleUs;
+		uint16_t PointsPerSecond;
+		uint16_t SweepCount;
+		uint8_t RSSI[SPECTRUM_POINTS];
+	} Data;
+} REPLY_0531_t;
+
+typedef struct {
+	Header_t Header;
+	uint8_t Age;
+	uint8_t Count;
+	uint8_t Padding[2];
+	uint32_t Timestamp;
+} CMD_0533_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint8_t Age;
+		uint8_t Count;
+		uint8_t Total;
+		uint8_t Padding;
+		uint8_t Rows[4][SPECTRUM_WATERFALL_ROW_SIZE];
+	} Data;
+} REPLY_0533_t;
+
+enum {
+	ACTIVITY_ACTION_READ  = 0U,
+	ACTIVITY_ACTION_CLEAR = 1U,
+	ACTIVITY_ACTION_SEED  = 2U,
+};
+
+typedef struct {
+	uint32_t Frequency;
+	uint8_t Score;
+	uint8_t Padding[3];
+} ActivityEntry_t;
+
+typedef struct {
+	Header_t Header;
+	uint8_t Action;
+	uint8_t Count;
+	uint8_t Padding[2];
+	uint32_t Timestamp;
+	ActivityEntry_t Entries[0];
+} CMD_0535_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		bool bScanEnabled;
+		uint8_t Padding[3];
+		ActivityEntry_t Entries[ACTIVITY_BINS];
+	} Data;
+} REPLY_0535_t;
+
+typedef struct {
+	Header_t Header;
+	uint32_t BaudRate;
+	uint32_t Timestamp;
+} CMD_0537_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t BaudRate;
+	} Data;
+} REPLY_0537_t;
+
+typedef struct {
+	Header_t Header;
+	uint16_t Offset;
+	uint16_t Size;
+	uint32_t Timestamp;
+} CMD_0539_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t Offset;
+		uint8_t Size;
+		bool bLast;
+		uint16_t CRC;
+		uint8_t Padding[2];
+		uint8_t Data[128];
+	} Data;
+} REPLY_0539_t;
+
+typedef struct {
+	Header_t Header;
+	uint16_t Offset;
+	uint8_t Size;
+	bool bFirst;
+	uint32_t Timestamp;
+	uint8_t Data[128];
+} CMD_053B_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t Offset;
+		uint8_t Size;
+		bool bWritten;
+		uint16_t CRC;
+		uint8_t Padding[2];
+	} Data;
+} REPLY_053B_t;
+
+typedef struct {
+	Header_t Header;
+	uint8_t Interval;
+	uint8_t Padding[3];
+	uint32_t Timestamp;
+} CMD_053D_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t Sequence;
+		uint16_t Dropped;
+		uint32_t Frequency;
+		uint16_t RSSI;
+		uint8_t ExNoiseIndicator;
+		uint8_t GlitchIndicator;
+		bool bSquelchOpen;
+		uint8_t Function;
+		uint16_t InterruptMask;
+		uint32_t InterruptTimestamp;
+		uint32_t PollLateMaxUs;
+		uint8_t Padding[4];
+	} Data;
+} REPLY_053D_t;
+
+typedef struct {
+	Header_t Header;
+	bool bSubscribe;
+	uint8_t Padding[3];
+	uint32_t Timestamp;
+} CMD_053F_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t Sequence;
+		uint8_t Line;
+		uint8_t Column;
+		uint8_t Length;
+		uint8_t Padding[3];
+		uint8_t Data[132];
+	} Data;
+} REPLY_053F_t;
+
+typedef struct {
+	uint8_t Key;
+	uint8_t Flags;
+	uint16_t Delay;
+} UART_KeyEvent_t;
+
+typedef struct {
+	Header_t Header;
+	uint8_t Count;
+	uint8_t Padding[3];
+	uint32_t Timestamp;
+	UART_KeyEvent_t Events[16];
+} CMD_0541_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Time;
+		uint8_t Key;
+		uint8_t Pending;
+		uint8_t Screen;
+		uint8_t Function;
+	} Data;
+} REPLY_0541_t;
+
+typedef struct {
+	Header_t Header;
+	uint32_t Timestamp;
+} CMD_0543_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t FunctionTicks[FUNCTION_COUNT];
+		uint16_t SaveTime;
+		uint8_t BatterySave;
+		uint8_t Function;
+	} Data;
+} REPLY_0543_t;
+
+typedef struct {
+	Header_t Header;
+	uint32_t Timestamp;
+} CMD_0547_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		ENERGY_Stats_t Energy;
+		uint8_t Function;
+		uint8_t Padding[3];
+	} Data;
+} REPLY_0547_t;
+
+// Frames are parsed as the bytes arrive, the payload and CRC are copied out
+// of the DMA ring and only decoded and checked once the footer is seen.
+enum {
+	PARSER_SYNC_AB = 0U,
+	PARSER_SYNC_CD,
+	PARSER_SIZE_LOW,
+	PARSER_SIZE_HIGH,
+	PARSER_PAYLOAD,
+	PARSER_FOOTER_DC,
+	PARSER_FOOTER_BA,
+};
+
+static const union {
+	uint8_t Bytes[16];
+	uint32_t Words[4];
+} Obfuscation = {
+	.Bytes = { 0x16, 0x6C, 0x14, 0xE6, 0x2E, 0x91, 0x0D, 0x40, 0x21, 0x35, 0xD5, 0x40, 0x13, 0x03, 0xE9, 0x80 },
+};
 
 static union {
 	uint8_t Buffer[256];
+	uint32_t Words[64];
 	struct {
 		Header_t Header;
 		uint8_t Data[252];
@@ -140,7 +380,88 @@ static union {
 
 static uint32_t Timestamp;
 static uint16_t gUART_WriteIndex;
+static uint16_t ActivityTimeout;
+static uint8_t FrameTimeout;
 static bool bIsEncrypted = true;
+static uint8_t ParserState;
+static uint16_t ParserSize;
+static uint16_t ParserLength;
+
+// The link counts as active for UART_ACTIVITY_TIMEOUT after the last byte
+// received, the core clock is not lowered while it is.
+#define UART_ACTIVITY_TIMEOUT	500U
+
+// A frame that stops arriving for UART_FRAME_TIMEOUT is dropped, so a frame
+// cut short by noise does not swallow the start of the next one.
+#define UART_FRAME_TIMEOUT	10U
+
+// A new baud rate is only used once the acknowledgement has been sent, and
+// is dropped again unless valid frames keep arriving at that rate.
+#define BAUD_CONFIRM_TIMEOUT	200U
+#define BAUD_IDLE_TIMEOUT	3000U
+
+static const uint32_t BaudRates[] = { 38400U, 57600U, 115200U, 230400U };
+
+static uint32_t BaudRate = UART_BAUD_DEFAULT;
+static uint32_t PendingBaudRate;
+static uint16_t BaudTimeout;
+
+// Streamed reads are sent from the 10ms slice as long as the transmit ring
+// has room, READ_STREAM_BURST frames at most per slice. The CRC in each frame
+// covers everything sent so far, the last one covers the whole range.
+#define READ_STREAM_BURST	2U
+
+static bool bReadStream;
+static uint16_t ReadStreamOffset;
+static uint16_t ReadStreamEnd;
+static uint16_t ReadStreamCRC;
+static uint16_t WriteStreamCRC;
+
+// EEPROM writes take a page per tick of 10ms and reply once the last write
+// cycle is over. The data stays in UART_Command, so no further frames are
+// parsed until then.
+static uint16_t WriteCommand;
+static const uint8_t *pWriteData;
+static uint16_t WriteOffset;
+static uint16_t WriteSize;
+static uint16_t WriteDone;
+static uint8_t WriteVerify;
+static bool bWriteSkipPassword;
+static bool bWriteReload;
+
+// Telemetry samples are pushed every Interval ticks of 10ms until the host
+// has been silent for TELEMETRY_TIMEOUT. A sample that does not fit in the
+// transmit ring is counted as dropped rather than stalling the main loop.
+#define TELEMETRY_TIMEOUT	500U
+
+static uint8_t TelemetryInterval;
+static uint8_t TelemetryCountdown;
+static uint16_t TelemetryTimeout;
+static uint16_t TelemetrySequence;
+static uint16_t TelemetryDropped;
+
+// The screen mirror keeps a copy of what the host was last sent. Blitted
+// lines are compared against it and the columns from the first to the last
+// changed byte are sent run-length encoded. Lines are only marked as sent
+// once they fit in the transmit ring.
+#define MIRROR_TIMEOUT		500U
+
+static bool bMirrorSubscribed;
+static uint8_t MirrorPending;
+static uint8_t MirrorForced;
+static uint16_t MirrorTimeout;
+static uint16_t MirrorSequence;
+static uint8_t MirrorShadow[8][sizeof(gStatusLine)];
+
+// Injected key events are pushed to the keyboard event queue by
+// APP_CheckKeys() in order, each one Delay ticks of 10ms after the previous.
+#define KEY_QUEUE_SIZE		16U
+#define KEY_FLAG_PRESSED	0x01U
+#define KEY_FLAG_HELD		0x02U
+
+static UART_KeyEvent_t KeyQueue[KEY_QUEUE_SIZE];
+static uint8_t KeyQueueRead;
+static uint8_t KeyQueueWrite;
 
 static void SendReply(void *pReply, uint16_t Size)
 {
@@ -152,7 +473,7 @@ static void SendReply(void *pReply, uint16_t Size)
 	if (bIsEncrypted) {
 		pBytes = (uint8_t *)pReply;
 		for (i = 0; i < Size; i++) {
-			pBytes[i] ^= Obfuscation[i % 16];
+			pBytes[i] ^= Obfuscation.Bytes[i % 16];
 		}
 	}
 
@@ -161,8 +482,8 @@ static void SendReply(void *pReply, uint16_t Size)
 	UART_Send(&Header, sizeof(Header));
 	UART_Send(pReply, Size);
 	if (bIsEncrypted) {
-		Footer.Padding[0] = Obfuscation[(Size + 0) % 16] ^ 0xFF;
-		Footer.Padding[1] = Obfuscation[(Size + 1) % 16] ^ 0xFF;
+		Footer.Padding[0] = Obfuscation.Bytes[(Size + 0) % 16] ^ 0xFF;
+		Footer.Padding[1] = Obfuscation.Bytes[(Size + 1) % 16] ^ 0xFF;
 	} else {
 		Footer.Padding[0] = 0xFF;
 		Footer.Padding[1] = 0xFF;
@@ -172,6 +493,12 @@ static void SendReply(void *pReply, uint16_t Size)
 	UART_Send(&Footer, sizeof(Footer));
 }
 
+// Room for a reply of Size bytes, sync, length and footer included
+static bool UART_HasTxSpace(uint16_t Size)
+{
+	return UART_GetTxSpace() >= sizeof(Header_t) + Size + sizeof(Footer_t);
+}
+
 static void SendVersion(void)
 {
 	REPLY_0514_t Reply;
@@ -246,52 +573,147 @@ static void CMD_051B(const uint8_t *pBuffer)
 	SendReply(&Reply, pCmd->Size + 8);
 }
 
-static void CMD_051D(const uint8_t *pBuffer)
+static bool UART_IsEepromLocked(void)
 {
-	const CMD_051D_t *pCmd = (const CMD_051D_t *)pBuffer;
-	REPLY_051D_t Reply;
-	bool bReloadEeprom;
-	bool bIsLocked;
-
-	if (pCmd->Timestamp != Timestamp) {
-		return;
+	if (bHasCustomAesKey) {
+		return gIsLocked;
 	}
 
-	bReloadEeprom = false;
+	return false;
+}
+
+static void SendEepromWriteReply(uint16_t Offset)
+{
+	REPLY_051D_t Reply;
 
-	//gFmRadioCountdown = 4;
 	Reply.Header.ID = 0x051E;
 	Reply.Header.Size = sizeof(Reply.Data);
-	Reply.Data.Offset = pCmd->Offset;
+	Reply.Data.Offset = Offset;
 
-	bIsLocked = bHasCustomAesKey;
-	if (bHasCustomAesKey) {
-		bIsLocked = gIsLocked;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void SendWriteStreamReply(uint16_t Offset, uint8_t Size, bool bWritten)
+{
+	REPLY_053B_t Reply;
+
+	memset(&Reply, 0, sizeof(Reply));
+	Reply.Header.ID = 0x053C;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Offset = Offset;
+	Reply.Data.Size = Size;
+	Reply.Data.bWritten = bWritten;
+	Reply.Data.CRC = WriteStreamCRC;
+
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static bool UART_IsWriteBlocked(uint16_t Offset)
+{
+	return bWriteSkipPassword && Offset >= 0x0E98 && Offset < 0x0EA0;
+}
+
+static void UART_StartWrite(uint16_t Command, uint16_t Offset, const uint8_t *pData, uint16_t Size, bool bSkipPassword)
+{
+	WriteCommand = Command;
+	WriteOffset = Offset;
+	pWriteData = pData;
+	WriteSize = Size;
+	WriteDone = 0;
+	WriteVerify = 0;
+	bWriteSkipPassword = bSkipPassword;
+	bWriteReload = false;
+}
+
+static void UART_FinishWrite(void)
+{
+	if (bWriteReload) {
+		BOARD_EEPROM_Init();
 	}
 
-	if (!bIsLocked) {
-		uint16_t i;
+	if (WriteCommand == 0x051D) {
+		SendEepromWriteReply(WriteOffset);
+	} else {
+		SendWriteStreamReply(WriteOffset, WriteSize, true);
+	}
 
-		for (i = 0; i < (pCmd->Size / 8U); i++) {
-			uint16_t Offset = pCmd->Offset + (i * 8U);
+	WriteCommand = 0;
+}
 
-			if (Offset >= 0x0F30 && Offset < 0x0F40) {
-				if (!gIsLocked) {
-					bReloadEeprom = true;
-				}
-			}
+// Starts the write of one page once the previous write cycle is over. Like
+// CMD_051D always did, the password is skipped in blocks of 8 bytes.
+static void UART_ServiceWrite(void)
+{
+	uint16_t Offset;
+	uint16_t Length;
+	uint16_t i;
 
-			if ((Offset < 0x0E98 || Offset >= 0x0EA0) || !bIsInLockScreen || pCmd->bAllowPassword) {
-				EEPROM_WriteBuffer(Offset, &pCmd->Data[i * 8U]);
-			}
+	if (WriteCommand == 0 || !EEPROM_IsReady()) {
+		return;
+	}
+
+	// Pages of streamed writes are read back into the running CRC, so the
+	// host checks what actually ended up in the EEPROM.
+	if (WriteVerify) {
+		uint8_t Verify[EEPROM_PAGE_SIZE];
+
+		EEPROM_ReadBuffer(WriteOffset + WriteDone - WriteVerify, Verify, WriteVerify);
+		WriteStreamCRC = CRC_Update(WriteStreamCRC, Verify, WriteVerify);
+		WriteVerify = 0;
+	}
+
+	while (WriteDone < WriteSize && UART_IsWriteBlocked(WriteOffset + (WriteDone & ~7U))) {
+		WriteDone = (WriteDone & ~7U) + 8;
+	}
+	if (WriteDone >= WriteSize) {
+		UART_FinishWrite();
+		return;
+	}
+
+	Offset = WriteOffset + WriteDone;
+	Length = EEPROM_PAGE_SIZE - (Offset % EEPROM_PAGE_SIZE);
+	if (Length > WriteSize - WriteDone) {
+		Length = WriteSize - WriteDone;
+	}
+	for (i = (WriteDone & ~7U) + 8; i < WriteDone + Length; i += 8) {
+		if (UART_IsWriteBlocked(WriteOffset + i)) {
+			Length = i - WriteDone;
+			break;
 		}
+	}
+
+	EEPROM_WritePage(Offset, pWriteData + WriteDone, Length);
+	if (WriteCommand == 0x053B) {
+		WriteVerify = Length;
+	}
 
-		if (bReloadEeprom) {
-			BOARD_EEPROM_Init();
+	if (Offset < 0x0F40 && Offset + Length > 0x0F30 && !gIsLocked) {
+		bWriteReload = true;
+	}
+	for (i = Offset & ~0x0FU; i < Offset + Length; i += 0x10) {
+		if (i >= 0x1C00 && i < 0x1E00) {
+			DTMF_InvalidateContact((i - 0x1C00) / 0x10);
 		}
 	}
 
-	SendReply(&Reply, sizeof(Reply));
+	WriteDone += Length;
+}
+
+static void CMD_051D(const uint8_t *pBuffer)
+{
+	const CMD_051D_t *pCmd = (const CMD_051D_t *)pBuffer;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+	//gFmRadioCountdown = 4;
+	if (UART_IsEepromLocked()) {
+		SendEepromWriteReply(pCmd->Offset);
+		return;
+	}
+
+	UART_StartWrite(0x051D, pCmd->Offset, pCmd->Data, pCmd->Size & ~7U, bIsInLockScreen && !pCmd->bAllowPassword);
 }
 
 static void CMD_0527(void)
@@ -375,77 +797,538 @@ static void CMD_052F(const uint8_t *pBuffer)
 	SendVersion();
 }
 
-bool UART_IsCommandAvailable(void)
+static void CMD_0531(void)
 {
-	uint16_t DmaLength;
-	uint16_t CommandLength;
-	uint16_t Index;
-	uint16_t TailIndex;
-	uint16_t Size;
-	uint16_t CRC;
-	uint16_t i;
+	REPLY_0531_t Reply;
+
+	Reply.Header.ID = 0x0532;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Center = gSpectrumCenter;
+	Reply.Data.Step = gSpectrumStep;
+	Reply.Data.SettleUs = gSpectrumSettleUs;
+	Reply.Data.PointsPerSecond = gSpectrumRate;
+	Reply.Data.SweepCount = gSpectrumSweepCount;
+	memcpy(Reply.Data.RSSI, gSpectrumRSSI, sizeof(Reply.Data.RSSI));
+
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0533(const uint8_t *pBuffer)
+{
+	const CMD_0533_t *pCmd = (const CMD_0533_t *)pBuffer;
+	REPLY_0533_t Reply;
+	uint8_t i;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+	Reply.Header.ID = 0x0534;
+	Reply.Data.Age = pCmd->Age;
+	Reply.Data.Count = 0;
+	Reply.Data.Total = gSpectrumWaterfallCount;
+	Reply.Data.Padding = 0;
+	// Ages past 255 would wrap around to the newest rows
+	for (i = 0; i < pCmd->Count && i < 4 && pCmd->Age + i <= 0xFF; i++) {
+		const uint8_t *pRow = SPECTRUM_GetWaterfallRow(pCmd->Age + i);
 
-	DmaLength = DMA_CH0->ST & 0xFFFU;
-	while (1) {
-		if (gUART_WriteIndex == DmaLength) {
-			return false;
+		if (pRow == NULL) {
+			break;
 		}
+		memcpy(Reply.Data.Rows[i], pRow, SPECTRUM_WATERFALL_ROW_SIZE);
+		Reply.Data.Count++;
+	}
+	Reply.Header.Size = 4 + (Reply.Data.Count * SPECTRUM_WATERFALL_ROW_SIZE);
 
-		while (gUART_WriteIndex != DmaLength && UART_DMA_Buffer[gUART_WriteIndex] != 0xABU) {
-			gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
+	SendReply(&Reply, Reply.Header.Size + 4);
+}
+
+static void CMD_0535(const uint8_t *pBuffer)
+{
+	const CMD_0535_t *pCmd = (const CMD_0535_t *)pBuffer;
+	REPLY_0535_t Reply;
+	uint8_t i;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+	if (pCmd->Action == ACTIVITY_ACTION_CLEAR) {
+		ACTIVITY_Clear();
+	} else if (pCmd->Action == ACTIVITY_ACTION_SEED) {
+		for (i = 0; i < pCmd->Count && i < ACTIVITY_BINS; i++) {
+			ACTIVITY_Seed(pCmd->Entries[i].Frequency, pCmd->Entries[i].Score);
 		}
+	}
+
+	memset(&Reply, 0, sizeof(Reply));
+	Reply.Header.ID = 0x0536;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.bScanEnabled = gActivityScanEnabled;
+	for (i = 0; i < ACTIVITY_BINS; i++) {
+		Reply.Data.Entries[i].Frequency = gActivityBins[i].Frequency;
+		Reply.Data.Entries[i].Score = gActivityBins[i].Score;
+	}
+
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0537(const uint8_t *pBuffer)
+{
+	const CMD_0537_t *pCmd = (const CMD_0537_t *)pBuffer;
+	REPLY_0537_t Reply;
+	uint8_t i;
 
-		if (gUART_WriteIndex == DmaLength) {
-			return false;
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+	Reply.Header.ID = 0x0538;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.BaudRate = 0;
+	for (i = 0; i < sizeof(BaudRates) / sizeof(BaudRates[0]); i++) {
+		if (pCmd->BaudRate == BaudRates[i]) {
+			Reply.Data.BaudRate = BaudRates[i];
+			PendingBaudRate = BaudRates[i];
+			break;
 		}
+	}
 
-		if (gUART_WriteIndex < DmaLength) {
-			CommandLength = DmaLength - gUART_WriteIndex;
-		} else {
-			CommandLength = (DmaLength + sizeof(UART_DMA_Buffer)) - gUART_WriteIndex;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0539(const uint8_t *pBuffer)
+{
+	const CMD_0539_t *pCmd = (const CMD_0539_t *)pBuffer;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+	ReadStreamOffset = pCmd->Offset;
+	ReadStreamEnd = pCmd->Offset;
+	ReadStreamCRC = 0;
+	if (!UART_IsEepromLocked() && pCmd->Offset < EEPROM_SIZE && pCmd->Size <= EEPROM_SIZE - pCmd->Offset) {
+		ReadStreamEnd += pCmd->Size;
+	}
+	bReadStream = true;
+}
+
+static void UART_ServiceReadStream(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < READ_STREAM_BURST && bReadStream; i++) {
+		REPLY_0539_t Reply;
+		uint16_t Size;
+
+		Size = ReadStreamEnd - ReadStreamOffset;
+		if (Size > sizeof(Reply.Data.Data)) {
+			Size = sizeof(Reply.Data.Data);
 		}
-		if (CommandLength < 8) {
-			return 0;
+		// The whole reply: its own header, the 8 bytes of Data before the
+		// payload and the payload, framing is added by UART_HasTxSpace()
+		if (!UART_HasTxSpace(sizeof(Header_t) + 8 + Size)) {
+			return;
 		}
-		if (UART_DMA_Buffer[DMA_INDEX(gUART_WriteIndex, 1)] == 0xCD) {
-			break;
+
+		Reply.Header.ID = 0x053A;
+		Reply.Header.Size = 8 + Size;
+		Reply.Data.Offset = ReadStreamOffset;
+		Reply.Data.Size = Size;
+		Reply.Data.Padding[0] = 0;
+		Reply.Data.Padding[1] = 0;
+		if (Size) {
+			EEPROM_ReadBuffer(ReadStreamOffset, Reply.Data.Data, Size);
+			ReadStreamCRC = CRC_Update(ReadStreamCRC, Reply.Data.Data, Size);
 		}
-		gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
+		ReadStreamOffset += Size;
+		Reply.Data.bLast = ReadStreamOffset == ReadStreamEnd;
+		Reply.Data.CRC = ReadStreamCRC;
+		bReadStream = !Reply.Data.bLast;
+
+		SendReply(&Reply, Reply.Header.Size + 4);
+	}
+}
+
+static void CMD_053B(const uint8_t *pBuffer)
+{
+	const CMD_053B_t *pCmd = (const CMD_053B_t *)pBuffer;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+	if (pCmd->bFirst) {
+		WriteStreamCRC = 0;
+	}
+
+	// Writes touching the password are refused while the lock screen is up
+	if (!UART_IsEepromLocked()
+		&& pCmd->Size <= sizeof(pCmd->Data)
+		&& pCmd->Offset < EEPROM_SIZE
+		&& pCmd->Size <= EEPROM_SIZE - pCmd->Offset
+		&& (pCmd->Offset + pCmd->Size <= 0x0E98 || pCmd->Offset >= 0x0EA0 || !bIsInLockScreen)) {
+		UART_StartWrite(0x053B, pCmd->Offset, pCmd->Data, pCmd->Size, false);
+	} else {
+		SendWriteStreamReply(pCmd->Offset, pCmd->Size, false);
+	}
+}
+
+static void UART_SendTelemetry(void)
+{
+	REPLY_053D_t Reply;
+
+	if (!UART_HasTxSpace(sizeof(Reply))) {
+		if (TelemetryDropped != 0xFFFF) {
+			TelemetryDropped++;
+		}
+		TelemetrySequence++;
+		return;
+	}
+
+	Reply.Header.ID = 0x053E;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Sequence = TelemetrySequence++;
+	Reply.Data.Dropped = TelemetryDropped;
+	Reply.Data.Frequency = gRxVfo->pCurrent->Frequency;
+	Reply.Data.RSSI = BK4819_GetRegister(BK4819_REG_67) & 0x01FF;
+	Reply.Data.ExNoiseIndicator = BK4819_GetRegister(BK4819_REG_65) & 0x007F;
+	Reply.Data.GlitchIndicator = BK4819_GetRegister(BK4819_REG_63);
+	Reply.Data.bSquelchOpen = g_SquelchLost;
+	Reply.Data.Function = gCurrentFunction;
+	Reply.Data.InterruptMask = gRadioInterruptMask;
+	Reply.Data.InterruptTimestamp = gRadioInterruptTimestamp;
+	Reply.Data.PollLateMaxUs = gRadioPollLateMaxUs;
+	memset(Reply.Data.Padding, 0, sizeof(Reply.Data.Padding));
+
+	SendReply(&Reply, sizeof(Reply));
+}
+
+// An interval of 0 returns a single sample and ends the subscription
+static void CMD_053D(const uint8_t *pBuffer)
+{
+	const CMD_053D_t *pCmd = (const CMD_053D_t *)pBuffer;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+	TelemetryInterval = pCmd->Interval;
+	TelemetryCountdown = pCmd->Interval;
+	TelemetryTimeout = TELEMETRY_TIMEOUT;
+	TelemetrySequence = 0;
+	TelemetryDropped = 0;
+
+	UART_SendTelemetry();
+}
+
+static void UART_ServiceTelemetry(void)
+{
+	if (TelemetryInterval == 0) {
+		return;
+	}
+
+	TelemetryTimeout--;
+	if (TelemetryTimeout == 0) {
+		TelemetryInterval = 0;
+		return;
+	}
+
+	TelemetryCountdown--;
+	if (TelemetryCountdown == 0) {
+		TelemetryCountdown = TelemetryInterval;
+		UART_SendTelemetry();
+	}
+}
+
+// A control byte with bit 7 set repeats the next byte (Control & 0x7F) + 1
+// times, otherwise Control + 1 literal bytes follow.
+static uint16_t UART_EncodeRLE(uint8_t *pOut, const uint8_t *pIn, uint8_t Size)
+{
+	uint16_t Length;
+	uint8_t i;
+
+	Length = 0;
+	i = 0;
+	while (i < Size) {
+		uint8_t Start;
+		uint8_t Run;
+
+		for (Run = 1; i + Run < Size && Run < 128 && pIn[i + Run] == pIn[i]; Run++) {
+		}
+		if (Run >= 3) {
+			pOut[Length++] = 0x80U | (Run - 1);
+			pOut[Length++] = pIn[i];
+			i += Run;
+			continue;
+		}
+
+		Start = i;
+		for (Run = 0; i < Size && Run < 128; i++, Run++) {
+			if (i + 2 < Size && pIn[i] == pIn[i + 1] && pIn[i] == pIn[i + 2]) {
+				break;
+			}
+		}
+		pOut[Length++] = Run - 1;
+		memcpy(pOut + Length, pIn + Start, Run);
+		Length += Run;
 	}
 
-	Index = DMA_INDEX(gUART_WriteIndex, 2);
-	Size = (UART_DMA_Buffer[DMA_INDEX(Index, 1)] << 8) | UART_DMA_Buffer[Index];
-	if (Size + 8 > sizeof(UART_DMA_Buffer)) {
-		gUART_WriteIndex = DmaLength;
+	return Length;
+}
+
+static bool UART_SendMirrorLine(uint8_t Line)
+{
+	const uint8_t *pLine = Line ? gFrameBuffer[Line - 1] : gStatusLine;
+	const bool bForced = (MirrorForced >> Line) & 1U;
+	REPLY_053F_t Reply;
+	uint8_t First;
+	uint8_t Last;
+
+	if (!UART_HasTxSpace(sizeof(Reply))) {
 		return false;
 	}
-	if (CommandLength < Size + 8) {
+
+	if (bForced) {
+		First = 0;
+		Last = sizeof(gStatusLine) - 1;
+	} else {
+		for (First = 0; First < sizeof(gStatusLine) && pLine[First] == MirrorShadow[Line][First]; First++) {
+		}
+		if (First == sizeof(gStatusLine)) {
+			return true;
+		}
+		for (Last = sizeof(gStatusLine) - 1; pLine[Last] == MirrorShadow[Line][Last]; Last--) {
+		}
+	}
+	memcpy(MirrorShadow[Line] + First, pLine + First, (Last - First) + 1);
+	MirrorForced &= ~(1U << Line);
+
+	Reply.Header.ID = 0x0540;
+	Reply.Data.Sequence = MirrorSequence++;
+	Reply.Data.Line = Line;
+	Reply.Data.Column = First;
+	Reply.Data.Length = (Last - First) + 1;
+	Reply.Data.Padding[0] = 0;
+	Reply.Data.Padding[1] = 0;
+	Reply.Data.Padding[2] = 0;
+	Reply.Header.Size = 8 + UART_EncodeRLE(Reply.Data.Data, pLine + Reply.Data.Column, Reply.Data.Length);
+
+	SendReply(&Reply, Reply.Header.Size + 4);
+
+	return true;
+}
+
+// Without a subscription, all lines are sent once
+static void CMD_053F(const uint8_t *pBuffer)
+{
+	const CMD_053F_t *pCmd = (const CMD_053F_t *)pBuffer;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+	bMirrorSubscribed = pCmd->bSubscribe;
+	MirrorTimeout = MIRROR_TIMEOUT;
+	MirrorSequence = 0;
+	MirrorPending = 0xFF;
+	MirrorForced = 0xFF;
+	gBlittedLines = 0;
+}
+
+static void UART_ServiceMirror(void)
+{
+	uint8_t Line;
+
+	if (bMirrorSubscribed) {
+		MirrorTimeout--;
+		if (MirrorTimeout == 0) {
+			bMirrorSubscribed = false;
+		} else {
+			MirrorPending |= gBlittedLines;
+		}
+	}
+	gBlittedLines = 0;
+
+	for (Line = 0; Line < 8 && MirrorPending; Line++) {
+		if ((MirrorPending >> Line) & 1U) {
+			if (!UART_SendMirrorLine(Line)) {
+				return;
+			}
+			MirrorPending &= ~(1U << Line);
+		}
+	}
+}
+
+static bool UART_IsValidKey(uint8_t Key)
+{
+	return Key <= KEY_F || (Key >= KEY_PTT && Key <= KEY_SIDE1);
+}
+
+void UART_ReportInjectedKey(KEY_Code_t Key)
+{
+	REPLY_0541_t Reply;
+
+	Reply.Header.ID = 0x0542;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Time = SYSTICK_GetTimestamp();
+	Reply.Data.Key = Key;
+	Reply.Data.Pending = KeyQueueWrite - KeyQueueRead;
+	Reply.Data.Screen = gScreenToDisplay;
+	Reply.Data.Function = gCurrentFunction;
+
+	SendReply(&Reply, sizeof(Reply));
+}
+
+// A Count of 0 only returns the current state
+static void CMD_0541(const uint8_t *pBuffer)
+{
+	const CMD_0541_t *pCmd = (const CMD_0541_t *)pBuffer;
+	uint8_t i;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+	if (!UART_IsEepromLocked()) {
+		for (i = 0; i < pCmd->Count && i < 16; i++) {
+			if ((uint8_t)(KeyQueueWrite - KeyQueueRead) == KEY_QUEUE_SIZE) {
+				break;
+			}
+			if (UART_IsValidKey(pCmd->Events[i].Key)) {
+				KeyQueue[KeyQueueWrite % KEY_QUEUE_SIZE] = pCmd->Events[i];
+				KeyQueueWrite++;
+			}
+		}
+	}
+
+	UART_ReportInjectedKey(KEY_INVALID);
+}
+
+bool UART_GetInjectedKey(KEY_Code_t *pKey, bool *pbKeyPressed, bool *pbKeyHeld)
+{
+	UART_KeyEvent_t *pEvent;
+
+	if (KeyQueueRead == KeyQueueWrite) {
 		return false;
 	}
-	Index = DMA_INDEX(Index, 2);
-	TailIndex = DMA_INDEX(Index, Size + 2);
-	if (UART_DMA_Buffer[TailIndex] != 0xDC || UART_DMA_Buffer[DMA_INDEX(TailIndex, 1)] != 0xBA) {
-		gUART_WriteIndex = DmaLength;
+
+	pEvent = &KeyQueue[KeyQueueRead % KEY_QUEUE_SIZE];
+	if (pEvent->Delay) {
+		pEvent->Delay--;
 		return false;
 	}
-	if (TailIndex < Index) {
-		uint16_t ChunkSize = sizeof(UART_DMA_Buffer) - Index;
 
-		memcpy(UART_Command.Buffer, UART_DMA_Buffer + Index, ChunkSize);
-		memcpy(UART_Command.Buffer + ChunkSize, UART_DMA_Buffer, TailIndex);
-	} else {
-		memcpy(UART_Command.Buffer, UART_DMA_Buffer + Index, TailIndex - Index);
+	*pKey = (KEY_Code_t)pEvent->Key;
+	*pbKeyPressed = (pEvent->Flags & KEY_FLAG_PRESSED) != 0;
+	*pbKeyHeld = (pEvent->Flags & KEY_FLAG_HELD) != 0;
+	KeyQueueRead++;
+
+	return true;
+}
+
+static void CMD_0543(const uint8_t *pBuffer)
+{
+	const CMD_0543_t *pCmd = (const CMD_0543_t *)pBuffer;
+	REPLY_0543_t Reply;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
 	}
 
-	TailIndex = DMA_INDEX(TailIndex, 2);
-	if (TailIndex < gUART_WriteIndex) {
-		memset(UART_DMA_Buffer + gUART_WriteIndex, 0, sizeof(UART_DMA_Buffer) - gUART_WriteIndex);
-		memset(UART_DMA_Buffer, 0, TailIndex);
+	Reply.Header.ID = 0x0544;
+	Reply.Header.Size = sizeof(Reply.Data);
+	memcpy(Reply.Data.FunctionTicks, gEnergy.Function, sizeof(Reply.Data.FunctionTicks));
+	Reply.Data.SaveTime = BATTERY_GetSaveTime();
+	Reply.Data.BatterySave = gEeprom.BATTERY_SAVE;
+	Reply.Data.Function = gCurrentFunction;
+
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0547(const uint8_t *pBuffer)
+{
+	const CMD_0547_t *pCmd = (const CMD_0547_t *)pBuffer;
+	REPLY_0547_t Reply;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+	Reply.Header.ID = 0x0548;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Energy = gEnergy;
+	Reply.Data.Function = gCurrentFunction;
+	Reply.Data.Padding[0] = 0;
+	Reply.Data.Padding[1] = 0;
+	Reply.Data.Padding[2] = 0;
+
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void UART_SwitchBaudRate(uint32_t NewBaudRate)
+{
+	UART_SetBaudRate(NewBaudRate);
+	BaudRate = NewBaudRate;
+	ParserState = PARSER_SYNC_AB;
+	if (NewBaudRate != UART_BAUD_DEFAULT) {
+		BaudTimeout = BAUD_CONFIRM_TIMEOUT;
 	} else {
-		memset(UART_DMA_Buffer + gUART_WriteIndex, 0, TailIndex - gUART_WriteIndex);
+		BaudTimeout = 0;
+	}
+}
+
+void UART_TimeSlice10ms(void)
+{
+	if (ActivityTimeout) {
+		ActivityTimeout--;
+	}
+	if (FrameTimeout) {
+		FrameTimeout--;
+		if (FrameTimeout == 0) {
+			ParserState = PARSER_SYNC_AB;
+		}
+	}
+
+	UART_ServiceWrite();
+
+	if (PendingBaudRate) {
+		if (UART_IsTxIdle()) {
+			UART_SwitchBaudRate(PendingBaudRate);
+			PendingBaudRate = 0;
+		}
+		return;
 	}
 
-	gUART_WriteIndex = TailIndex;
+	if (BaudTimeout) {
+		BaudTimeout--;
+		if (BaudTimeout == 0) {
+			UART_SwitchBaudRate(UART_BAUD_DEFAULT);
+		}
+	}
+
+	UART_ServiceTelemetry();
+	UART_ServiceMirror();
+	UART_ServiceReadStream();
+}
+
+bool UART_IsActive(void)
+{
+	return ActivityTimeout || WriteCommand || bReadStream || TelemetryInterval || bMirrorSubscribed || !UART_IsTxIdle();
+}
+
+bool UART_IsRxIdle(void)
+{
+	return ParserState == PARSER_SYNC_AB && gUART_WriteIndex == (DMA_CH0->ST & 0xFFFU);
+}
+
+// De-obfuscates a word at a time and feeds the CRC unit in the same pass.
+// The buffer is large enough for the last partial word to be decoded whole.
+static bool UART_DecodeCommand(void)
+{
+	const uint16_t Size = ParserSize;
+	uint16_t CRC;
 
 	if (UART_Command.Header.ID == 0x0514) {
 		bIsEncrypted = false;
@@ -455,17 +1338,130 @@ bool UART_IsCommandAvailable(void)
 	}
 
 	if (bIsEncrypted) {
-		for (i = 0; i < Size + 2; i++) {
-			UART_Command.Buffer[i] ^= Obfuscation[i % 16];
+		uint16_t i;
+
+		CRC_CR = (CRC_CR & ~CRC_CR_CRC_EN_MASK) | CRC_CR_CRC_EN_BITS_ENABLE;
+		for (i = 0; i < Size + 2; i += 4) {
+			const uint32_t Word = UART_Command.Words[i / 4] ^ Obfuscation.Words[(i / 4) % 4];
+			uint8_t j;
+
+			UART_Command.Words[i / 4] = Word;
+			for (j = 0; j < 4 && i + j < Size; j++) {
+				CRC_DATAIN = (Word >> (j * 8)) & 0xFFU;
+			}
 		}
+		CRC = (uint16_t)CRC_DATAOUT;
+		CRC_CR = (CRC_CR & ~CRC_CR_CRC_EN_MASK) | CRC_CR_CRC_EN_BITS_DISABLE;
+	} else {
+		CRC = CRC_Calculate(UART_Command.Buffer, Size);
 	}
 
-	CRC = UART_Command.Buffer[Size] | (UART_Command.Buffer[Size + 1] << 8);
-	if (CRC_Calculate(UART_Command.Buffer, Size) != CRC) {
+	return CRC == (UART_Command.Buffer[Size] | (UART_Command.Buffer[Size + 1] << 8));
+}
+
+bool UART_IsCommandAvailable(void)
+{
+	const uint16_t DmaLength = DMA_CH0->ST & 0xFFFU;
+
+	if (WriteCommand) {
 		return false;
 	}
 
-	return true;
+	if (gUART_WriteIndex != DmaLength) {
+		ActivityTimeout = UART_ACTIVITY_TIMEOUT;
+		FrameTimeout = UART_FRAME_TIMEOUT;
+	}
+
+	while (gUART_WriteIndex != DmaLength) {
+		uint8_t Byte;
+
+		if (ParserState == PARSER_PAYLOAD) {
+			uint16_t Length;
+			uint16_t Available;
+
+			// Take as much as is contiguous in the ring in one go
+			if (DmaLength > gUART_WriteIndex) {
+				Available = DmaLength - gUART_WriteIndex;
+			} else {
+				Available = sizeof(UART_DMA_Buffer) - gUART_WriteIndex;
+			}
+			Length = (ParserSize + 2) - ParserLength;
+			if (Length > Available) {
+				Length = Available;
+			}
+			memcpy(UART_Command.Buffer + ParserLength, UART_DMA_Buffer + gUART_WriteIndex, Length);
+			ParserLength += Length;
+			gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, Length);
+			if (ParserLength == ParserSize + 2) {
+				ParserState = PARSER_FOOTER_DC;
+			}
+			continue;
+		}
+
+		Byte = UART_DMA_Buffer[gUART_WriteIndex];
+		gUART_WriteIndex = DMA_INDEX(gUART_WriteIndex, 1);
+
+		switch (ParserState) {
+		case PARSER_SYNC_AB:
+			if (Byte == 0xAB) {
+				ParserState = PARSER_SYNC_CD;
+			}
+			break;
+
+		case PARSER_SYNC_CD:
+			if (Byte == 0xCD) {
+				ParserState = PARSER_SIZE_LOW;
+			} else if (Byte != 0xAB) {
+				ParserState = PARSER_SYNC_AB;
+			}
+			break;
+
+		case PARSER_SIZE_LOW:
+			ParserSize = Byte;
+			ParserState = PARSER_SIZE_HIGH;
+			break;
+
+		case PARSER_SIZE_HIGH:
+			ParserSize |= Byte << 8;
+			ParserLength = 0;
+			if (ParserSize + 8 > sizeof(UART_DMA_Buffer)) {
+				ParserState = PARSER_SYNC_AB;
+			} else {
+				ParserState = PARSER_PAYLOAD;
+			}
+			break;
+
+		case PARSER_FOOTER_DC:
+			if (Byte == 0xDC) {
+				ParserState = PARSER_FOOTER_BA;
+			} else {
+				ParserState = PARSER_SYNC_AB;
+			}
+			break;
+
+		case PARSER_FOOTER_BA:
+			ParserState = PARSER_SYNC_AB;
+			if (Byte == 0xBA && UART_DecodeCommand()) {
+				if (BaudRate != UART_BAUD_DEFAULT) {
+					BaudTimeout = BAUD_IDLE_TIMEOUT;
+				}
+				if (TelemetryInterval) {
+					TelemetryTimeout = TELEMETRY_TIMEOUT;
+				}
+				if (bMirrorSubscribed) {
+					MirrorTimeout = MIRROR_TIMEOUT;
+				}
+				return true;
+			}
+			break;
+
+		default:
+			ParserState = PARSER_SYNC_AB;
+			break;
+		}
+	}
+
+	return false;
 }
 
 void UART_HandleCommand(void)
@@ -507,6 +1503,50 @@ void UART_HandleCommand(void)
 		CMD_052F(UART_Command.Buffer);
 		break;
 
+	case 0x0531:
+		CMD_0531();
+		break;
+
+	case 0x0533:
+		CMD_0533(UART_Command.Buffer);
+		break;
+
+	case 0x0535:
+		CMD_0535(UART_Command.Buffer);
+		break;
+
+	case 0x0537:
+		CMD_0537(UART_Command.Buffer);
+		break;
+
+	case 0x0539:
+		CMD_0539(UART_Command.Buffer);
+		break;
+
+	case 0x053B:
+		CMD_053B(UART_Command.Buffer);
+		break;
+
+	case 0x053D:
+		CMD_053D(UART_Command.Buffer);
+		break;
+
+	case 0x053F:
+		CMD_053F(UART_Command.Buffer);
+		break;
+
+	case 0x0541:
+		CMD_0541(UART_Command.Buffer);
+		break;
+
+	case 0x0543:
+		CMD_0543(UART_Command.Buffer);
+		break;
+
+	case 0x0547:
+		CMD_0547(UART_Command.Buffer);
+		break;
+
 	case 0x05DD:
 		overlay_FLASH_RebootToBootloader();
 		break;
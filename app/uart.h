@@ -18,9 +18,15 @@
 #define APP_UART_H
 
 #include <stdbool.h>
+#include "driver/keyboard.h"
 
 bool UART_IsCommandAvailable(void);
 void UART_HandleCommand(void);
+void UART_TimeSlice10ms(void);
+bool UART_IsActive(void);
+bool UART_IsRxIdle(void);
+bool UART_GetInjectedKey(KEY_Code_t *pKey, bool *pbKeyPressed, bool *pbKeyHeld);
+void UART_ReportInjectedKey(KEY_Code_t Key);
 
 #endif
 
@@ -300,7 +300,7 @@ void BOARD_ADC_Init(void)
 	Config.CLK_SEL = SYSCON_CLK_SEL_W_SARADC_SMPL_VALUE_DIV2;
 	Config.CH_SEL = ADC_CH4 | ADC_CH9;
 	Config.AVG = SARADC_CFG_AVG_VALUE_8_SAMPLE;
-	Config.CONT = SARADC_CFG_CONT_VALUE_SINGLE;
+	Config.CONT = SARADC_CFG_CONT_VALUE_CONTINUOUS;
 	Config.MEM_MODE = SARADC_CFG_MEM_MODE_VALUE_CHANNEL;
 	Config.SMPL_CLK = SARADC_CFG_SMPL_CLK_VALUE_INTERNAL;
 	Config.SMPL_WIN = SARADC_CFG_SMPL_WIN_VALUE_15_CYCLE;
@@ -315,13 +315,19 @@ void BOARD_ADC_Init(void)
 	ADC_Configure(&Config);
 	ADC_Enable();
 	ADC_SoftReset();
+	ADC_Start();
 }
 
+// The SARADC converts both channels continuously into their data registers,
+// so only the very first reading after reset has to wait for a conversion.
 void BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage, uint16_t *pCurrent)
 {
-	ADC_Start();
+	static bool bConverted;
 
-	while (!ADC_CheckEndOfConversion(ADC_CH9)) {
+	if (!bConverted) {
+		while (!ADC_CheckEndOfConversion(ADC_CH9)) {
+		}
+		bConverted = true;
 	}
 	*pVoltage = ADC_GetValue(ADC_CH4);
 	*pCurrent = ADC_GetValue(ADC_CH9);
@@ -357,7 +363,7 @@ void BOARD_EEPROM_Init(void)
 	EEPROM_ReadBuffer(0x0E78, Data, 8);
 	gEeprom.CHANNEL_DISPLAY_MODE  = (Data[1] < 3) ? Data[1] : MDF_FREQUENCY;
 	gEeprom.CROSS_BAND_RX_TX      = (Data[2] < 3) ? Data[2] : CROSS_BAND_OFF;
-	gEeprom.BATTERY_SAVE          = (Data[3] < 5) ? Data[3] : 4;
+	gEeprom.BATTERY_SAVE          = (Data[3] < 6) ? Data[3] : 4;
 	gEeprom.DUAL_WATCH            = (Data[4] < 3) ? Data[4] : DUAL_WATCH_CHAN_A;
 	gEeprom.BACKLIGHT             = (Data[5] < 61) ? Data[5] : 60;
 	gEeprom.TAIL_NOTE_ELIMINATION = (Data[6] < 2) ? Data[6] : true;
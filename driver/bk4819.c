@@ -30,6 +30,8 @@ static uint16_t gBK4819_GpioOutState;
 
 bool gRxIdleMode;
 
+static bool bSleeping;
+
 void BK4819_Init(void)
 {
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
@@ -74,16 +76,16 @@ static uint16_t BK4819_ReadU16(void)
 
 	PORTCON_PORTC_IE = (PORTCON_PORTC_IE & ~PORTCON_PORTC_IE_C2_MASK) | PORTCON_PORTC_IE_C2_BITS_ENABLE;
 	GPIOC->DIR = (GPIOC->DIR & ~GPIO_DIR_2_MASK) | GPIO_DIR_2_BITS_INPUT;
-	SYSTICK_DelayUs(1);
+	SYSTICK_DelayNs(BK4819_DELAY_NS);
 
 	Value = 0;
 	for (i = 0; i < 16; i++) {
 		Value <<= 1;
 		Value |= GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
 		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
 	}
 	PORTCON_PORTC_IE = (PORTCON_PORTC_IE & ~PORTCON_PORTC_IE_C2_MASK) | PORTCON_PORTC_IE_C2_BITS_DISABLE;
 	GPIOC->DIR = (GPIOC->DIR & ~GPIO_DIR_2_MASK) | GPIO_DIR_2_BITS_OUTPUT;
@@ -97,7 +99,7 @@ uint16_t BK4819_GetRegister(BK4819_REGISTER_t Register)
 
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-	SYSTICK_DelayUs(1);
+	SYSTICK_DelayNs(BK4819_DELAY_NS);
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 
 	BK4819_WriteU8(Register | 0x80);
@@ -105,7 +107,7 @@ uint16_t BK4819_GetRegister(BK4819_REGISTER_t Register)
 	Value = BK4819_ReadU16();
 
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
-	SYSTICK_DelayUs(1);
+	SYSTICK_DelayNs(BK4819_DELAY_NS);
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 
@@ -116,14 +118,14 @@ void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
 {
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-	SYSTICK_DelayUs(1);
+	SYSTICK_DelayNs(BK4819_DELAY_NS);
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	BK4819_WriteU8(Register);
-	SYSTICK_DelayUs(1);
+	SYSTICK_DelayNs(BK4819_DELAY_NS);
 	BK4819_WriteU16(Data);
-	SYSTICK_DelayUs(1);
+	SYSTICK_DelayNs(BK4819_DELAY_NS);
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
-	SYSTICK_DelayUs(1);
+	SYSTICK_DelayNs(BK4819_DELAY_NS);
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 }
@@ -139,12 +141,12 @@ void BK4819_WriteU8(uint8_t Data)
 		} else {
 			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 		}
-		SYSTICK_DelayUs(1);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
 		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
 		Data <<= 1;
 		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
 	}
 }
 
@@ -159,12 +161,12 @@ void BK4819_WriteU16(uint16_t Data)
 		} else {
 			GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 		}
-		SYSTICK_DelayUs(1);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
 		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 		Data <<= 1;
-		SYSTICK_DelayUs(1);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
 		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
-		SYSTICK_DelayUs(1);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
 	}
 }
 
@@ -366,6 +368,7 @@ void BK4819_RX_TurnOn(void)
 	// Enable XTAL
 	// Enable Band Gap
 	BK4819_WriteRegister(BK4819_REG_37, 0x1F0F);
+	bSleeping = false;
 
 	// Turn off everything
 	BK4819_WriteRegister(BK4819_REG_30, 0);
@@ -480,6 +483,12 @@ void BK4819_Sleep(void)
 {
 	BK4819_WriteRegister(BK4819_REG_30, 0);
 	BK4819_WriteRegister(BK4819_REG_37, 0x1D00);
+	bSleeping = true;
+}
+
+bool BK4819_IsSleeping(void)
+{
+	return bSleeping;
 }
 
 void BK4819_TurnsOffTones_TurnsOnRX(void)
@@ -527,6 +536,7 @@ void BK4819_PrepareTransmit(void)
 void BK4819_TxOn_Beep(void)
 {
 	BK4819_WriteRegister(BK4819_REG_37, 0x1D0F);
+	bSleeping = false;
 	BK4819_WriteRegister(BK4819_REG_52, 0x028F);
 	BK4819_WriteRegister(BK4819_REG_30, 0x0000);
 	BK4819_WriteRegister(BK4819_REG_30, 0xC1FE);
@@ -825,6 +835,41 @@ uint8_t BK4819_GetCTCType(void)
 	return (BK4819_GetRegister(BK4819_REG_0C) >> 10) & 3;
 }
 
+// Reads REG_0C and, when an interrupt is pending, acknowledges it and fetches
+// the REG_02 flags without returning the bus to idle between the frames.
+// REG_0C is handed back as well since it also holds the CDCSS code type.
+bool BK4819_GetInterruptRequest(uint16_t *pStatus, uint16_t *pMask)
+{
+	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
+	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
+	SYSTICK_DelayNs(BK4819_DELAY_NS);
+	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
+	BK4819_WriteU8(BK4819_REG_0C | 0x80);
+	*pStatus = BK4819_ReadU16();
+	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
+
+	if (*pStatus & 1U) {
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
+		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
+		BK4819_WriteU8(BK4819_REG_02);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
+		BK4819_WriteU16(0);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
+		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
+		SYSTICK_DelayNs(BK4819_DELAY_NS);
+		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
+		BK4819_WriteU8(BK4819_REG_02 | 0x80);
+		*pMask = BK4819_ReadU16();
+		GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
+	}
+
+	SYSTICK_DelayNs(BK4819_DELAY_NS);
+	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
+	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
+
+	return (*pStatus & 1U) != 0;
+}
+
 void BK4819_SendFSKData(uint16_t *pData)
 {
 	uint8_t i;
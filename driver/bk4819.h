@@ -21,6 +21,9 @@
 #include <stdint.h>
 #include "driver/bk4819-regs.h"
 
+// Setup and hold time around every SCL and SCN edge, SCL runs at about 2MHz
+#define BK4819_DELAY_NS 250U
+
 enum BK4819_AF_Type_t {
 	BK4819_AF_MUTE = 0U,
 	BK4819_AF_OPEN = 1U,
@@ -86,6 +89,7 @@ void BK4819_PlayTone(uint16_t Frequency, bool bTuningGainSwitch);
 void BK4819_EnterTxMute(void);
 void BK4819_ExitTxMute(void);
 void BK4819_Sleep(void);
+bool BK4819_IsSleeping(void);
 void BK4819_TurnsOffTones_TurnsOnRX(void);
 void BK4819_ResetFSK(void);
 void BK4819_Idle(void);
@@ -125,6 +129,7 @@ uint8_t BK4819_GetDTMF_5TONE_Code(void);
 
 uint8_t BK4819_GetCDCSSCodeType(void);
 uint8_t BK4819_GetCTCType(void);
+bool BK4819_GetInterruptRequest(uint16_t *pStatus, uint16_t *pMask);
 
 void BK4819_SendFSKData(uint16_t *pData);
 void BK4819_PrepareFSKReceive(void);
@@ -48,3 +48,14 @@ uint16_t CRC_Calculate(const void *pBuffer, uint16_t Size)
 	return Crc;
 }
 
+// Continues a CRC over another block, Crc being the result for the data so
+// far. The unit has no output inversion so the running value is the seed.
+uint16_t CRC_Update(uint16_t Crc, const void *pBuffer, uint16_t Size)
+{
+	CRC_IV = Crc;
+	Crc = CRC_Calculate(pBuffer, Size);
+	CRC_IV = 0;
+
+	return Crc;
+}
+
@@ -17,9 +17,48 @@
 #include "driver/eeprom.h"
 #include "driver/i2c.h"
 #include "driver/system.h"
+#include "driver/systick.h"
+
+#define EEPROM_READY_POLLS 120U
+
+static bool bWriteCycle;
+
+// The device does not acknowledge its address until the write cycle is over
+bool EEPROM_IsReady(void)
+{
+	int Ret;
+
+	if (!bWriteCycle) {
+		return true;
+	}
+
+	I2C_Start();
+	Ret = I2C_Write(0xA0);
+	I2C_Stop();
+	if (Ret == 0) {
+		bWriteCycle = false;
+	}
+
+	return !bWriteCycle;
+}
+
+static void EEPROM_WaitReady(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < EEPROM_READY_POLLS; i++) {
+		if (EEPROM_IsReady()) {
+			return;
+		}
+		SYSTICK_DelayUs(100);
+	}
+	bWriteCycle = false;
+}
 
 void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
 {
+	EEPROM_WaitReady();
+
 	I2C_Start();
 
 	I2C_Write(0xA0);
@@ -39,6 +78,8 @@ void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
 void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer)
 
 {
+	EEPROM_WaitReady();
+
 	I2C_Start();
 
 	I2C_Write(0xA0);
@@ -53,3 +94,23 @@ void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer)
 	SYSTEM_DelayMs(10);
 }
 
+// Size bytes must not cross a page boundary. The write cycle runs in the
+// background, the next access waits for it unless EEPROM_IsReady() is polled.
+void EEPROM_WritePage(uint16_t Address, const void *pBuffer, uint8_t Size)
+{
+	EEPROM_WaitReady();
+
+	I2C_Start();
+
+	I2C_Write(0xA0);
+
+	I2C_Write((Address >> 8) & 0xFF);
+	I2C_Write((Address >> 0) & 0xFF);
+
+	I2C_WriteBuffer(pBuffer, Size);
+
+	I2C_Stop();
+
+	bWriteCycle = true;
+}
+
@@ -17,10 +17,16 @@
 #ifndef DRIVER_EEPROM_H
 #define DRIVER_EEPROM_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#define EEPROM_SIZE		0x2000U
+#define EEPROM_PAGE_SIZE	32U
+
 void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size);
 void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer);
+void EEPROM_WritePage(uint16_t Address, const void *pBuffer, uint8_t Size);
+bool EEPROM_IsReady(void);
 
 #endif
 
@@ -20,6 +20,10 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// A bit is low for two delays and high for one, which meets the 1.3us low and
+// 0.6us high periods of 400kHz Fast-mode and leaves room for the SDA pull-up.
+#define I2C_DELAY_NS 700U
+
 enum {
 	I2C_WRITE = 0U,
 	I2C_READ = 1U,
@@ -25,133 +25,119 @@ KEY_Code_t gKeyReading1 = KEY_INVALID;
 uint16_t gDebounceCounter;
 bool gWasFKeyPressed;
 
-KEY_Code_t KEYBOARD_Poll(void)
+// Rows are driven low one at a time on pins 10 to 13 and the columns read
+// back together from pins 3 to 6. Row 0 is the side keys, which connect their
+// column to ground without any row being driven.
+#define KEYBOARD_ROWS_MASK	(0xFU << GPIOA_PIN_KEYBOARD_4)
+
+static const KEY_Code_t Keymap[5][4] = {
+	{ KEY_SIDE1, KEY_SIDE2, KEY_INVALID, KEY_INVALID },
+	{ KEY_MENU,  KEY_1,     KEY_4,       KEY_7       },
+	{ KEY_UP,    KEY_2,     KEY_5,       KEY_8       },
+	{ KEY_DOWN,  KEY_3,     KEY_6,       KEY_9       },
+	{ KEY_EXIT,  KEY_STAR,  KEY_0,       KEY_F       },
+};
+
+static KEY_Event_t Events[KEY_EVENT_QUEUE_SIZE];
+static uint8_t ReadIndex;
+static uint8_t WriteIndex;
+static uint8_t Count;
+
+static uint8_t KEYBOARD_ReadColumns(uint8_t Rows)
 {
-	KEY_Code_t Key = KEY_INVALID;
+	GPIOA->DATA = (GPIOA->DATA & ~KEYBOARD_ROWS_MASK) | ((uint32_t)Rows << GPIOA_PIN_KEYBOARD_4);
+	SYSTICK_DelayNs(KEYBOARD_SETTLE_NS);
 
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_5);
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_6);
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_7);
+	return (~GPIOA->DATA >> GPIOA_PIN_KEYBOARD_0) & 0xFU;
+}
 
-	SYSTICK_DelayUs(1);
+uint32_t KEYBOARD_Scan(void)
+{
+	uint32_t Keys;
+	uint8_t Grounded;
+	uint8_t Row;
 
-	// Keys connected to gnd
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_0)) {
-		Key = KEY_SIDE1;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_1)) {
-		Key = KEY_SIDE2;
-		goto Bye;
-	}
-	// Original doesn't do PTT
+	Keys = 0;
 
-	// First row
-	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
-	SYSTICK_DelayUs(1);
+	// Side keys pull their column low whichever row is driven
+	Grounded = KEYBOARD_ReadColumns(0xFU);
+	for (Row = 0; Row < 5; Row++) {
+		uint8_t Columns;
+		uint8_t Column;
 
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_0)) {
-		Key = KEY_MENU;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_1)) {
-		Key = KEY_1;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_2)) {
-		Key = KEY_4;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_3)) {
-		Key = KEY_7;
-		goto Bye;
+		if (Row == 0) {
+			Columns = Grounded;
+		} else {
+			Columns = KEYBOARD_ReadColumns(0xFU & ~(1U << (Row - 1))) & ~Grounded;
+		}
+		for (Column = 0; Column < 4; Column++) {
+			if (((Columns >> Column) & 1U) && Keymap[Row][Column] != KEY_INVALID) {
+				Keys |= KEYBOARD_MASK(Keymap[Row][Column]);
+			}
+		}
 	}
 
-	// Second row
-	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_5);
-	SYSTICK_DelayUs(1);
+	// Idle state, only the third row driven low
+	GPIOA->DATA = (GPIOA->DATA & ~KEYBOARD_ROWS_MASK) | (0xBU << GPIOA_PIN_KEYBOARD_4);
 
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
-	SYSTICK_DelayUs(1);
-
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_0)) {
-		Key = KEY_UP;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_1)) {
-		Key = KEY_2;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_2)) {
-		Key = KEY_5;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_3)) {
-		Key = KEY_8;
-		goto Bye;
+	if (!GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_PTT)) {
+		Keys |= KEYBOARD_MASK(KEY_PTT);
 	}
 
-	// Third row
-	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
-	SYSTICK_DelayUs(1);
-
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_5);
-	SYSTICK_DelayUs(1);
+	return Keys;
+}
 
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
-	SYSTICK_DelayUs(1);
+// First key in scan order, PTT is not part of the matrix
+KEY_Code_t KEYBOARD_GetKey(uint32_t Keys)
+{
+	uint8_t Row;
+	uint8_t Column;
 
-	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_6);
-	SYSTICK_DelayUs(1);
+	for (Row = 0; Row < 5; Row++) {
+		for (Column = 0; Column < 4; Column++) {
+			const KEY_Code_t Key = Keymap[Row][Column];
 
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_0)) {
-		Key = KEY_DOWN;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_1)) {
-		Key = KEY_3;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_2)) {
-		Key = KEY_6;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_3)) {
-		Key = KEY_9;
-		goto Bye;
+			if (Key != KEY_INVALID && (Keys & KEYBOARD_MASK(Key))) {
+				return Key;
+			}
+		}
 	}
 
-	// Fourth row
-	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_7);
-	SYSTICK_DelayUs(1);
+	return KEY_INVALID;
+}
 
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_6);
-	SYSTICK_DelayUs(1);
+KEY_Code_t KEYBOARD_Poll(void)
+{
+	return KEYBOARD_GetKey(KEYBOARD_Scan());
+}
 
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_0)) {
-		Key = KEY_EXIT;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_1)) {
-		Key = KEY_STAR;
-		goto Bye;
-	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_2)) {
-		Key = KEY_0;
-		goto Bye;
+void KEYBOARD_PushEvent(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
+{
+	KEY_Event_t *pEvent;
+
+	if (Count == KEY_EVENT_QUEUE_SIZE) {
+		ReadIndex = (ReadIndex + 1) % KEY_EVENT_QUEUE_SIZE;
+		Count--;
 	}
-	if (!GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_3)) {
-		Key = KEY_F;
-		goto Bye;
+
+	pEvent = &Events[WriteIndex];
+	pEvent->Key = Key;
+	pEvent->bKeyPressed = bKeyPressed;
+	pEvent->bKeyHeld = bKeyHeld;
+	WriteIndex = (WriteIndex + 1) % KEY_EVENT_QUEUE_SIZE;
+	Count++;
+}
+
+bool KEYBOARD_PopEvent(KEY_Event_t *pEvent)
+{
+	if (Count == 0) {
+		return false;
 	}
 
-Bye:
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_4);
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_5);
-	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_6);
-	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_KEYBOARD_7);
+	*pEvent = Events[ReadIndex];
+	ReadIndex = (ReadIndex + 1) % KEY_EVENT_QUEUE_SIZE;
+	Count--;
 
-	return Key;
+	return true;
 }
 
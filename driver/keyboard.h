@@ -21,6 +21,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// Time for a column to follow a row driven low through the key matrix
+#define KEYBOARD_SETTLE_NS	1500U
+
 enum KEY_Code_t {
 	KEY_0 = 0,
 	KEY_1 = 1,
@@ -46,12 +49,26 @@ enum KEY_Code_t {
 
 typedef enum KEY_Code_t KEY_Code_t;
 
+typedef struct {
+	KEY_Code_t Key;
+	bool bKeyPressed;
+	bool bKeyHeld;
+} KEY_Event_t;
+
+#define KEY_EVENT_QUEUE_SIZE 8U
+
+#define KEYBOARD_MASK(Key) (1UL << (Key))
+
 extern KEY_Code_t gKeyReading0;
 extern KEY_Code_t gKeyReading1;
 extern uint16_t gDebounceCounter;
 extern bool gWasFKeyPressed;
 
+uint32_t KEYBOARD_Scan(void);
+KEY_Code_t KEYBOARD_GetKey(uint32_t Keys);
 KEY_Code_t KEYBOARD_Poll(void);
+void KEYBOARD_PushEvent(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
+bool KEYBOARD_PopEvent(KEY_Event_t *pEvent);
 
 #endif
 
@@ -24,6 +24,7 @@
 
 uint8_t gStatusLine[128];
 uint8_t gFrameBuffer[7][128];
+uint8_t gBlittedLines;
 
 void ST7565_DrawLine(uint8_t Column, uint8_t Line, uint16_t Size, const uint8_t *pBitmap, bool bIsClearMode)
 {
@@ -49,6 +50,7 @@ void ST7565_DrawLine(uint8_t Column, uint8_t Line, uint16_t Size, const uint8_t
 
 	SPI_WaitForUndocumentedTxFifoStatusBit();
 	SPI_ToggleMasterMode(&SPI0->CR, true);
+	gBlittedLines |= 1U << Line;
 }
 
 void ST7565_BlitFullScreen(void)
@@ -72,6 +74,7 @@ void ST7565_BlitFullScreen(void)
 
 	SYSTEM_DelayMs(20);
 	SPI_ToggleMasterMode(&SPI0->CR, true);
+	gBlittedLines |= 0xFEU;
 }
 
 void ST7565_BlitStatusLine(void)
@@ -90,6 +93,7 @@ void ST7565_BlitStatusLine(void)
 	}
 	SPI_WaitForUndocumentedTxFifoStatusBit();
 	SPI_ToggleMasterMode(&SPI0->CR, true);
+	gBlittedLines |= 0x01U;
 }
 
 void ST7565_FillScreen(uint8_t Value)
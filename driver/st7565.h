@@ -22,6 +22,8 @@
 
 extern uint8_t gStatusLine[128];
 extern uint8_t gFrameBuffer[7][128];
+// Bit 0 is the status line, bits 1 to 7 the frame buffer lines
+extern uint8_t gBlittedLines;
 
 void ST7565_DrawLine(uint8_t Column, uint8_t Line, uint16_t Size, const uint8_t *pBitmap, bool bIsClearMode);
 void ST7565_BlitFullScreen(void);
@@ -14,10 +14,16 @@
  *     limitations under the License.
  */
 
+#include "ARMCM0.h"
 #include "bsp/dp32g030/pmu.h"
 #include "bsp/dp32g030/syscon.h"
+#include "driver/flash.h"
 #include "driver/system.h"
 #include "driver/systick.h"
+#include "driver/uart.h"
+#include "sram-overlay.h"
+
+static SYSTEM_CLOCK_PROFILE ClockProfile;
 
 void SYSTEM_DelayMs(uint32_t Delay)
 {
@@ -38,3 +44,42 @@ void SYSTEM_ConfigureClocks(void)
 	SYSCON_DIV_CLK_GATE = (SYSCON_DIV_CLK_GATE & ~SYSCON_DIV_CLK_GATE_DIV_CLK_GATE_MASK) | SYSCON_DIV_CLK_GATE_DIV_CLK_GATE_BITS_DISABLE;
 }
 
+// The 12MHz profile runs the core from RCHF through the divider. Flash wait
+// states go up before the clock does and down after it has dropped, and the
+// SysTick reload, UART divisor and flash timings follow the new clock.
+void SYSTEM_SetClockProfile(SYSTEM_CLOCK_PROFILE Profile)
+{
+	uint32_t Primask;
+	uint8_t MHz;
+
+	if (Profile == ClockProfile) {
+		return;
+	}
+
+	Primask = __get_PRIMASK();
+	__disable_irq();
+
+	ClockProfile = Profile;
+	MHz = SYSTEM_GetClockMHz();
+	overlay_FLASH_MainClock = MHz * 1000000U;
+	overlay_FLASH_ClockMultiplier = MHz;
+
+	if (Profile == SYSTEM_CLOCK_PROFILE_12MHZ) {
+		SYSCON_CLK_SEL = SYSCON_CLK_SEL_SYS_BITS_DIV_CLK | SYSCON_CLK_SEL_DIV_BITS_4 | SYSCON_CLK_SEL_SRC_BITS_RCHF;
+		FLASH_Init(FLASH_READ_MODE_1_CYCLE);
+	} else {
+		FLASH_Init(FLASH_READ_MODE_2_CYCLE);
+		SYSCON_CLK_SEL = SYSCON_CLK_SEL_SYS_BITS_RCHF | SYSCON_CLK_SEL_DIV_BITS_2;
+	}
+
+	SYSTICK_SetClock(MHz);
+	UART_UpdateClock();
+
+	__set_PRIMASK(Primask);
+}
+
+uint8_t SYSTEM_GetClockMHz(void)
+{
+	return (ClockProfile == SYSTEM_CLOCK_PROFILE_12MHZ) ? 12U : 48U;
+}
+
@@ -19,8 +19,17 @@
 
 #include <stdint.h>
 
+enum SYSTEM_CLOCK_PROFILE {
+	SYSTEM_CLOCK_PROFILE_48MHZ = 0U,
+	SYSTEM_CLOCK_PROFILE_12MHZ,
+};
+
+typedef enum SYSTEM_CLOCK_PROFILE SYSTEM_CLOCK_PROFILE;
+
 void SYSTEM_DelayMs(uint32_t Delay);
 void SYSTEM_ConfigureClocks(void);
+void SYSTEM_SetClockProfile(SYSTEM_CLOCK_PROFILE Profile);
+uint8_t SYSTEM_GetClockMHz(void);
 
 #endif
 
@@ -20,6 +20,8 @@
 
 // 0x20000324
 static uint32_t gTickMultiplier;
+// Microseconds of the ticks cut short by SYSTICK_SetClock()
+static uint32_t gTickOffsetUs;
 
 void SYSTICK_Init(void)
 {
@@ -27,6 +29,17 @@ void SYSTICK_Init(void)
 	gTickMultiplier = 48;
 }
 
+// Keeps the tick at 10ms. Writing VAL can only clear it, so the tick in
+// progress is restarted and the time it had already run is carried over in
+// gTickOffsetUs, which keeps timestamps from going backwards.
+void SYSTICK_SetClock(uint8_t MHz)
+{
+	gTickOffsetUs += (SysTick->LOAD - SysTick->VAL) / gTickMultiplier;
+	SysTick->LOAD = (MHz * 10000U) - 1U;
+	SysTick->VAL = 0;
+	gTickMultiplier = MHz;
+}
+
 void SYSTICK_DelayUs(uint32_t Delay)
 {
 	uint32_t i;
@@ -52,3 +65,18 @@ void SYSTICK_DelayUs(uint32_t Delay)
 	} while (i < Delay * gTickMultiplier);
 }
 
+// Microseconds since boot, wraps every ~71 minutes. The tick counter is
+// sampled on both sides of VAL so a reload in between is not missed.
+uint32_t SYSTICK_GetTimestamp(void)
+{
+	uint32_t Ticks;
+	uint32_t Current;
+
+	do {
+		Ticks = gGlobalSysTickCounter;
+		Current = SysTick->VAL;
+	} while (Ticks != gGlobalSysTickCounter);
+
+	return (Ticks * 10000U) + gTickOffsetUs + ((SysTick->LOAD - Current) / gTickMultiplier);
+}
+
@@ -19,8 +19,35 @@
 
 #include <stdint.h>
 
+#define SYSTICK_CPU_MHZ 48U
+
+// Busy waits for the bit-banged buses. A loop iteration is 4 cycles on the
+// M0 (SUBS and a taken BNE) and the last BNE falls through in 1, so Loops
+// take 4 * Loops - 2 cycles. Flash wait states can only make it longer. The
+// count is for the fastest clock, slower profiles only stretch the delay.
+#define SYSTICK_DELAY_LOOPS(Delay) ((((Delay) * SYSTICK_CPU_MHZ) + 2000U + 3999U) / 4000U)
+
+static inline void SYSTICK_DelayLoops(uint32_t Loops)
+{
+	__asm volatile (
+		"1:	subs %0, #1\n"
+		"	bne 1b\n"
+		: "+l" (Loops)
+		:
+		: "cc"
+	);
+}
+
+// Delay must be a non-zero constant for the division to fold at compile time
+static inline void SYSTICK_DelayNs(uint32_t Delay)
+{
+	SYSTICK_DelayLoops(SYSTICK_DELAY_LOOPS(Delay));
+}
+
 void SYSTICK_Init(void);
+void SYSTICK_SetClock(uint8_t MHz);
 void SYSTICK_DelayUs(uint32_t Delay);
+uint32_t SYSTICK_GetTimestamp(void);
 
 #endif
 
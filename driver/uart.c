@@ -15,21 +15,81 @@
  */
 
 #include <stdbool.h>
+#include <string.h>
+#include "ARMCM0.h"
 #include "bsp/dp32g030/dma.h"
+#include "bsp/dp32g030/irq.h"
 #include "bsp/dp32g030/syscon.h"
 #include "bsp/dp32g030/uart.h"
+#include "driver/system.h"
 #include "driver/uart.h"
 
+#define UART_TX_BUFFER_SIZE 512U
+
 static bool UART_IsLogEnabled;
+static uint32_t UART_BaudRate = UART_BAUD_DEFAULT;
 uint8_t UART_DMA_Buffer[256];
 
-void UART_Init(void)
+// Transmit ring drained by DMA_CH1, one contiguous run at a time. TxActive
+// is the length of the run in flight, the tail only moves on completion.
+static uint8_t UART_TxBuffer[UART_TX_BUFFER_SIZE];
+static uint16_t TxHead;
+static volatile uint16_t TxTail;
+static volatile uint16_t TxActive;
+
+void HandlerDMA(void);
+
+// Must be called with interrupts masked
+static void UART_StartTx(void)
+{
+	uint16_t Length;
+
+	if (TxActive || TxHead == TxTail) {
+		return;
+	}
+
+	if (TxHead > TxTail) {
+		Length = TxHead - TxTail;
+	} else {
+		Length = UART_TX_BUFFER_SIZE - TxTail;
+	}
+	TxActive = Length;
+
+	DMA_CH1->CTR = DMA_CH_CTR_CH_EN_BITS_DISABLE;
+	DMA_CH1->MSADDR = (uint32_t)(uintptr_t)&UART_TxBuffer[TxTail];
+	DMA_CH1->CTR = 0
+		| DMA_CH_CTR_CH_EN_BITS_ENABLE
+		| (((Length - 1U) << DMA_CH_CTR_LENGTH_SHIFT) & DMA_CH_CTR_LENGTH_MASK)
+		| DMA_CH_CTR_LOOP_BITS_DISABLE
+		| DMA_CH_CTR_PRI_BITS_LOW
+		;
+}
+
+static void UART_ServiceTx(void)
+{
+	if ((DMA_INTST & DMA_INTST_CH1_TC_INTST_MASK) == DMA_INTST_CH1_TC_INTST_BITS_NOT_SET) {
+		return;
+	}
+
+	DMA_INTST = DMA_INTST_CH1_TC_INTST_BITS_SET;
+	TxTail = (TxTail + TxActive) % UART_TX_BUFFER_SIZE;
+	TxActive = 0;
+	UART_StartTx();
+}
+
+void HandlerDMA(void)
+{
+	UART_ServiceTx();
+}
+
+// The stock divisor for 38400 baud is Frequency / 39053, other rates keep
+// the same correction. Frequency is the trimmed RCHF scaled to the core clock.
+static uint32_t UART_GetBaudDivisor(uint32_t BaudRate)
 {
 	uint32_t Delta;
 	uint32_t Positive;
 	uint32_t Frequency;
 
-	UART1->CTRL = (UART1->CTRL & ~UART_CTRL_UARTEN_MASK) | UART_CTRL_UARTEN_BITS_DISABLE;
 	Delta = SYSCON_RC_FREQ_DELTA;
 	Positive = (Delta & SYSCON_RC_FREQ_DELTA_RCHF_SIG_MASK) >> SYSCON_RC_FREQ_DELTA_RCHF_SIG_SHIFT;
 	Frequency = (Delta & SYSCON_RC_FREQ_DELTA_RCHF_DELTA_MASK) >> SYSCON_RC_FREQ_DELTA_RCHF_DELTA_SHIFT;
@@ -39,8 +99,16 @@ void UART_Init(void)
 		Frequency = 48000000U - Frequency;
 	}
 
-	UART1->BAUD = Frequency / 39053U;
-	UART1->CTRL = UART_CTRL_RXEN_BITS_ENABLE | UART_CTRL_TXEN_BITS_ENABLE | UART_CTRL_RXDMAEN_BITS_ENABLE;
+	Frequency = (Frequency / 48U) * SYSTEM_GetClockMHz();
+
+	return Frequency / (((BaudRate / 100U) * 39053U) / 384U);
+}
+
+void UART_Init(void)
+{
+	UART1->CTRL = (UART1->CTRL & ~UART_CTRL_UARTEN_MASK) | UART_CTRL_UARTEN_BITS_DISABLE;
+	UART1->BAUD = UART_GetBaudDivisor(UART_BAUD_DEFAULT);
+	UART1->CTRL = UART_CTRL_RXEN_BITS_ENABLE | UART_CTRL_TXEN_BITS_ENABLE | UART_CTRL_RXDMAEN_BITS_ENABLE | UART_CTRL_TXDMAEN_BITS_ENABLE;
 	UART1->RXTO = 4;
 	UART1->FC = 0;
 	UART1->FIFO = UART_FIFO_RF_LEVEL_BITS_8_BYTE | UART_FIFO_RF_CLR_BITS_ENABLE | UART_FIFO_TF_CLR_BITS_ENABLE;
@@ -60,7 +128,19 @@ void UART_Init(void)
 		| DMA_CH_MOD_MD_SIZE_BITS_8BIT
 		| DMA_CH_MOD_MD_SEL_BITS_SRAM
 		;
-	DMA_INTEN = 0;
+	DMA_CH1->MSADDR = (uint32_t)(uintptr_t)UART_TxBuffer;
+	DMA_CH1->MDADDR = (uint32_t)(uintptr_t)&UART1->TDR;
+	DMA_CH1->MOD = 0
+		// Source
+		| DMA_CH_MOD_MS_ADDMOD_BITS_INCREMENT
+		| DMA_CH_MOD_MS_SIZE_BITS_8BIT
+		| DMA_CH_MOD_MS_SEL_BITS_SRAM
+		// Destination
+		| DMA_CH_MOD_MD_ADDMOD_BITS_NONE
+		| DMA_CH_MOD_MD_SIZE_BITS_8BIT
+		| DMA_CH_MOD_MD_SEL_BITS_HSREQ_MS1
+		;
+	DMA_INTEN = DMA_INTEN_CH1_TC_INTEN_BITS_ENABLE;
 	DMA_INTST = 0
 		| DMA_INTST_CH0_TC_INTST_BITS_SET
 		| DMA_INTST_CH1_TC_INTST_BITS_SET
@@ -80,22 +160,72 @@ void UART_Init(void)
 	UART1->IF = UART_IF_RXTO_BITS_SET;
 
 	DMA_CTR = (DMA_CTR & ~DMA_CTR_DMAEN_MASK) | DMA_CTR_DMAEN_BITS_ENABLE;
+	NVIC_EnableIRQ(DP32_DMA_IRQn);
 
 	UART1->CTRL |= UART_CTRL_UARTEN_BITS_ENABLE;
 }
 
+// Queues the data and returns, only waits when the ring is full. With
+// interrupts masked (UART command handlers) completion is polled instead.
 void UART_Send(const void *pBuffer, uint32_t Size)
 {
 	const uint8_t *pData = (const uint8_t *)pBuffer;
-	uint32_t i;
 
-	for (i = 0; i < Size; i++) {
-		UART1->TDR = pData[i];
-		while ((UART1->IF & UART_IF_TXFIFO_FULL_MASK) != UART_IF_TXFIFO_FULL_BITS_NOT_SET) {
+	while (Size) {
+		const uint32_t Primask = __get_PRIMASK();
+		uint16_t Length;
+
+		__disable_irq();
+		if (Primask) {
+			UART_ServiceTx();
+		}
+		Length = (TxTail + UART_TX_BUFFER_SIZE - TxHead - 1U) % UART_TX_BUFFER_SIZE;
+		__set_PRIMASK(Primask);
+
+		if (Length > UART_TX_BUFFER_SIZE - TxHead) {
+			Length = UART_TX_BUFFER_SIZE - TxHead;
+		}
+		if (Length > Size) {
+			Length = Size;
 		}
+		if (Length == 0) {
+			continue;
+		}
+
+		memcpy(&UART_TxBuffer[TxHead], pData, Length);
+		pData += Length;
+		Size -= Length;
+
+		__disable_irq();
+		TxHead = (TxHead + Length) % UART_TX_BUFFER_SIZE;
+		UART_StartTx();
+		__set_PRIMASK(Primask);
 	}
 }
 
+void UART_SetBaudRate(uint32_t BaudRate)
+{
+	UART1->CTRL = (UART1->CTRL & ~UART_CTRL_UARTEN_MASK) | UART_CTRL_UARTEN_BITS_DISABLE;
+	UART1->BAUD = UART_GetBaudDivisor(BaudRate);
+	UART1->CTRL |= UART_CTRL_UARTEN_BITS_ENABLE;
+	UART_BaudRate = BaudRate;
+}
+
+void UART_UpdateClock(void)
+{
+	UART_SetBaudRate(UART_BaudRate);
+}
+
+uint16_t UART_GetTxSpace(void)
+{
+	return (TxTail + UART_TX_BUFFER_SIZE - TxHead - 1U) % UART_TX_BUFFER_SIZE;
+}
+
+bool UART_IsTxIdle(void)
+{
+	return TxHead == TxTail && (UART1->IF & UART_IF_TXBUSY_MASK) == UART_IF_TXBUSY_BITS_NOT_SET;
+}
+
 void UART_LogSend(const void *pBuffer, uint32_t Size)
 {
 	if (UART_IsLogEnabled) {
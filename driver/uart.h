@@ -18,13 +18,20 @@
 #ifndef DRIVER_UART_H
 #define DRIVER_UART_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#define UART_BAUD_DEFAULT 38400U
+
 extern uint8_t UART_DMA_Buffer[256];
 
 void UART_Init(void);
 void UART_Send(const void *pBuffer, uint32_t Size);
 void UART_LogSend(const void *pBuffer, uint32_t Size);
+void UART_SetBaudRate(uint32_t BaudRate);
+void UART_UpdateClock(void);
+bool UART_IsTxIdle(void);
+uint16_t UART_GetTxSpace(void);
 
 #endif
 
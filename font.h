@@ -19,9 +19,20 @@
 
 #include <stdint.h>
 
-extern const uint8_t gFontBig[95][16];
+typedef struct {
+	const uint8_t *pData;
+	const uint16_t *pBlocks;
+	uint16_t Count;
+	uint8_t Width;
+	uint8_t Pages;
+} FONT_Packed_t;
+
+extern const FONT_Packed_t gFontBig;
 extern const uint8_t gFontSmallDigits[11][7];
 extern const uint8_t gFont3x5[160][3];
 
+void FONT_Decode(const FONT_Packed_t *pFont, uint8_t Index, uint8_t *pOut);
+const uint8_t *FONT_GetBig(uint8_t Code);
+
 #endif
 
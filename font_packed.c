@@ -0,0 +1,212 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Generated by gen-font.py from font_big.inc, win1251/font_big_cyrillic.inc, do not edit.
+// 2544 bytes unpacked.
+
+#include "font.h"
+
+static const uint8_t FontBigData[2084] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x09, 0x70, 0x00, 0xF8, 0x1B,
+	0x70, 0x00, 0x28, 0x28, 0x1E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x1E, 0x00,
+	0x9A, 0x26, 0x40, 0x04, 0xF0, 0x1F, 0x40, 0x04, 0xF0, 0x1F, 0x40, 0x04,
+	0xAA, 0x29, 0x70, 0x06, 0xF8, 0x0C, 0x88, 0x08, 0x8F, 0x38, 0x98, 0x0F,
+	0x30, 0x07, 0xAA, 0x2A, 0x60, 0x18, 0x60, 0x0C, 0x00, 0x06, 0x00, 0x03,
+	0x80, 0x01, 0xC0, 0x18, 0x60, 0x18, 0xAA, 0x2A, 0x00, 0x0F, 0xB0, 0x1F,
+	0xF8, 0x10, 0xC8, 0x11, 0x78, 0x0F, 0xB0, 0x1F, 0x80, 0x10, 0xA8, 0x00,
+	0x20, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0xA0, 0x0A, 0xE0, 0x07, 0xF0, 0x0F,
+	0x18, 0x18, 0x08, 0x10, 0xA0, 0x0A, 0x08, 0x10, 0x18, 0x18, 0xF0, 0x0F,
+	0xE0, 0x07, 0xAA, 0xA9, 0x00, 0x01, 0x40, 0x05, 0xC0, 0x07, 0x80, 0x03,
+	0xC0, 0x07, 0x40, 0x05, 0x00, 0x01, 0x98, 0x19, 0x00, 0x01, 0xC0, 0x07,
+	0x00, 0x01, 0xA0, 0x02, 0x00, 0x20, 0x00, 0x3C, 0x00, 0x1C, 0x56, 0x15,
+	0x00, 0x01, 0x80, 0x01, 0x00, 0x18, 0xAA, 0x2A, 0x00, 0x18, 0x00, 0x0C,
+	0x00, 0x06, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x60, 0x00, 0xAA, 0x2A,
+	0xF0, 0x0F, 0xF8, 0x1F, 0x08, 0x12, 0x88, 0x11, 0x48, 0x10, 0xF8, 0x1F,
+	0xF0, 0x0F, 0xA8, 0x19, 0x20, 0x10, 0x30, 0x10, 0xF8, 0x1F, 0x00, 0x10,
+	0xAA, 0x2A, 0x10, 0x1C, 0x18, 0x1E, 0x08, 0x13, 0x88, 0x11, 0xC8, 0x10,
+	0x78, 0x18, 0x30, 0x18, 0x6A, 0x29, 0x10, 0x08, 0x18, 0x18, 0x88, 0x10,
+	0xF8, 0x1F, 0x70, 0x0F, 0xAA, 0x26, 0x80, 0x01, 0xC0, 0x01, 0x60, 0x01,
+	0x30, 0x11, 0xF8, 0x1F, 0x00, 0x11, 0x6A, 0x2A, 0xF8, 0x08, 0xF8, 0x18,
+	0x88, 0x10, 0x88, 0x11, 0x88, 0x1F, 0x08, 0x0F, 0xAA, 0x29, 0xE0, 0x0F,
+	0xF0, 0x1F, 0x98, 0x10, 0x88, 0x10, 0x80, 0x1F, 0x00, 0x0F, 0xA6, 0x2A,
+	0x18, 0x00, 0x08, 0x1E, 0x08, 0x1F, 0x88, 0x01, 0xF8, 0x00, 0x78, 0x00,
+	0x6A, 0x29, 0x70, 0x0F, 0xF8, 0x1F, 0x88, 0x10, 0xF8, 0x1F, 0x70, 0x0F,
+	0x6A, 0x2A, 0x70, 0x00, 0xF8, 0x10, 0x88, 0x10, 0x88, 0x18, 0xF8, 0x0F,
+	0xF0, 0x07, 0x80, 0x01, 0x60, 0x0C, 0xA0, 0x02, 0x00, 0x10, 0x60, 0x1C,
+	0x60, 0x0C, 0xA8, 0x2A, 0x00, 0x01, 0x80, 0x03, 0xC0, 0x06, 0x60, 0x0C,
+	0x30, 0x18, 0x10, 0x10, 0x56, 0x15, 0x80, 0x04, 0xA8, 0x2A, 0x10, 0x10,
+	0x30, 0x18, 0x60, 0x0C, 0xC0, 0x06, 0x80, 0x03, 0x00, 0x01, 0xAA, 0x2A,
+	0x30, 0x00, 0x38, 0x00, 0x08, 0x00, 0x88, 0x1B, 0xC8, 0x1B, 0x78, 0x00,
+	0x30, 0x00, 0xAA, 0x29, 0xE0, 0x0F, 0xF0, 0x1F, 0x10, 0x10, 0x90, 0x17,
+	0xF0, 0x17, 0xE0, 0x03, 0xAA, 0x2A, 0xC0, 0x1F, 0xE0, 0x1F, 0x30, 0x01,
+	0x18, 0x01, 0x30, 0x01, 0xE0, 0x1F, 0xC0, 0x1F, 0x9A, 0x29, 0x08, 0x10,
+	0xF8, 0x1F, 0x88, 0x10, 0xF8, 0x1F, 0x70, 0x0F, 0xAA, 0x29, 0xE0, 0x07,
+	0xF0, 0x0F, 0x18, 0x18, 0x08, 0x10, 0x18, 0x18, 0x30, 0x0C, 0x9A, 0x2A,
+	0x08, 0x10, 0xF8, 0x1F, 0x08, 0x10, 0x18, 0x18, 0xF0, 0x0F, 0xE0, 0x07,
+	0x9A, 0x2A, 0x08, 0x10, 0xF8, 0x1F, 0x88, 0x10, 0xC8, 0x11, 0x18, 0x18,
+	0x38, 0x1C, 0x9A, 0x2A, 0x08, 0x10, 0xF8, 0x1F, 0x88, 0x10, 0xC8, 0x01,
+	0x18, 0x00, 0x38, 0x00, 0xAA, 0x29, 0xE0, 0x07, 0xF0, 0x0F, 0x18, 0x18,
+	0x08, 0x11, 0x18, 0x0F, 0x30, 0x1F, 0x66, 0x19, 0xF8, 0x1F, 0x80, 0x00,
+	0xF8, 0x1F, 0xA0, 0x09, 0x08, 0x10, 0xF8, 0x1F, 0x08, 0x10, 0xAA, 0x2A,
+	0x00, 0x0E, 0x00, 0x1E, 0x00, 0x10, 0x08, 0x10, 0xF8, 0x1F, 0xF8, 0x0F,
+	0x08, 0x00, 0x9A, 0x2A, 0x08, 0x10, 0xF8, 0x1F, 0x80, 0x01, 0xE0, 0x03,
+	0x78, 0x1E, 0x18, 0x1C, 0x9A, 0x2A, 0x08, 0x10, 0xF8, 0x1F, 0x08, 0x10,
+	0x00, 0x10, 0x00, 0x18, 0x00, 0x1C, 0xA6, 0x1A, 0xF8, 0x1F, 0x70, 0x00,
+	0xE0, 0x00, 0x70, 0x00, 0xF8, 0x1F, 0xA6, 0x1A, 0xF8, 0x1F, 0x70, 0x00,
+	0xE0, 0x00, 0xC0, 0x01, 0xF8, 0x1F, 0xAA, 0x2A, 0xE0, 0x07, 0xF0, 0x0F,
+	0x18, 0x18, 0x08, 0x10, 0x18, 0x18, 0xF0, 0x0F, 0xE0, 0x07, 0x9A, 0x2A,
+	0x08, 0x10, 0xF8, 0x1F, 0x88, 0x10, 0x88, 0x00, 0xF8, 0x00, 0x70, 0x00,
+	0xAA, 0x2A, 0xF0, 0x0F, 0xF8, 0x1F, 0x08, 0x10, 0x08, 0x1C, 0x08, 0x78,
+	0xF8, 0x7F, 0xF0, 0x4F, 0x9A, 0x2A, 0x08, 0x10, 0xF8, 0x1F, 0x88, 0x00,
+	0x88, 0x01, 0xF8, 0x1F, 0x70, 0x1E, 0xAA, 0x2A, 0x30, 0x0C, 0x78, 0x1C,
+	0xC8, 0x10, 0x88, 0x10, 0x88, 0x11, 0x38, 0x1F, 0x30, 0x0E, 0xA8, 0x29,
+	0x38, 0x00, 0x18, 0x10, 0xF8, 0x1F, 0x18, 0x10, 0x38, 0x00, 0x6A, 0x29,
+	0xF8, 0x0F, 0xF8, 0x1F, 0x00, 0x10, 0xF8, 0x1F, 0xF8, 0x0F, 0xAA, 0x2A,
+	0xF8, 0x03, 0xF8, 0x07, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x0C, 0xF8, 0x07,
+	0xF8, 0x03, 0xAA, 0x2A, 0xF8, 0x07, 0xF8, 0x1F, 0x00, 0x1C, 0x00, 0x07,
+	0x00, 0x1C, 0xF8, 0x1F, 0xF8, 0x07, 0xAA, 0x2A, 0x18, 0x18, 0x78, 0x1E,
+	0xE0, 0x07, 0x80, 0x01, 0xE0, 0x07, 0x78, 0x1E, 0x18, 0x18, 0xA8, 0x29,
+	0x78, 0x00, 0xF8, 0x10, 0x80, 0x1F, 0xF8, 0x10, 0x78, 0x00, 0xAA, 0x2A,
+	0x38, 0x1C, 0x18, 0x1E, 0x08, 0x13, 0x88, 0x11, 0xC8, 0x10, 0x78, 0x18,
+	0x38, 0x1C, 0x60, 0x06, 0xF8, 0x1F, 0x08, 0x10, 0xAA, 0x2A, 0x70, 0x00,
+	0xE0, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1C,
+	0x60, 0x06, 0x08, 0x10, 0xF8, 0x1F, 0xAA, 0x2A, 0x10, 0x00, 0x18, 0x00,
+	0x0E, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x18, 0x00, 0x10, 0x00, 0x56, 0x55,
+	0x00, 0x40, 0xA0, 0x02, 0x07, 0x00, 0x0F, 0x00, 0x08, 0x00, 0x6A, 0x2A,
+	0x00, 0x0E, 0x40, 0x1F, 0x40, 0x11, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x10,
+	0xAA, 0x2A, 0x08, 0x10, 0xF8, 0x1F, 0xF8, 0x0F, 0x40, 0x10, 0xC0, 0x10,
+	0x80, 0x1F, 0x00, 0x0F, 0x6A, 0x29, 0x80, 0x0F, 0xC0, 0x1F, 0x40, 0x10,
+	0xC0, 0x18, 0x80, 0x08, 0xAA, 0x2A, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x10,
+	0x48, 0x10, 0xF8, 0x0F, 0xF8, 0x1F, 0x00, 0x10, 0x6A, 0x29, 0x80, 0x0F,
+	0xC0, 0x1F, 0x40, 0x11, 0xC0, 0x19, 0x80, 0x09, 0xAA, 0x0A, 0x80, 0x10,
+	0xF0, 0x1F, 0xF8, 0x1F, 0x88, 0x10, 0x18, 0x00, 0x30, 0x00, 0x6A, 0x2A,
+	0x80, 0x4F, 0xC0, 0xDF, 0x40, 0x90, 0x80, 0xFF, 0xC0, 0x7F, 0x40, 0x00,
+	0x9A, 0x2A, 0x08, 0x10, 0xF8, 0x1F, 0x80, 0x00, 0x40, 0x00, 0xC0, 0x1F,
+	0x80, 0x1F, 0xA0, 0x09, 0x40, 0x10, 0xD8, 0x1F, 0x00, 0x10, 0xA8, 0x2A,
+	0x00, 0x60, 0x00, 0xE0, 0x00, 0x80, 0x40, 0x80, 0xD8, 0xFF, 0xD8, 0x7F,
+	0x9A, 0x2A, 0x08, 0x10, 0xF8, 0x1F, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x1C,
+	0x40, 0x18, 0xA0, 0x09, 0x08, 0x10, 0xF8, 0x1F, 0x00, 0x10, 0xA6, 0x2A,
+	0xC0, 0x1F, 0xC0, 0x00, 0x80, 0x1F, 0xC0, 0x00, 0xC0, 0x1F, 0x80, 0x1F,
+	0xAA, 0x29, 0x40, 0x00, 0xC0, 0x1F, 0x80, 0x1F, 0x40, 0x00, 0xC0, 0x1F,
+	0x80, 0x1F, 0x6A, 0x29, 0x80, 0x0F, 0xC0, 0x1F, 0x40, 0x10, 0xC0, 0x1F,
+	0x80, 0x0F, 0xAA, 0x2A, 0x40, 0x80, 0xC0, 0xFF, 0x80, 0xFF, 0x40, 0x90,
+	0x40, 0x10, 0xC0, 0x1F, 0x80, 0x0F, 0xAA, 0x2A, 0x80, 0x0F, 0xC0, 0x1F,
+	0x40, 0x10, 0x40, 0x90, 0x80, 0xFF, 0xC0, 0xFF, 0x40, 0x80, 0xAA, 0x2A,
+	0x40, 0x10, 0xC0, 0x1F, 0x80, 0x1F, 0xC0, 0x10, 0x40, 0x00, 0xC0, 0x00,
+	0x80, 0x01, 0xAA, 0x2A, 0x80, 0x08, 0xC0, 0x19, 0x40, 0x13, 0x40, 0x12,
+	0x40, 0x16, 0xC0, 0x1C, 0x80, 0x08, 0xA6, 0x2A, 0x40, 0x00, 0xF0, 0x0F,
+	0xF8, 0x1F, 0x40, 0x10, 0x40, 0x18, 0x00, 0x08, 0x6A, 0x2A, 0xC0, 0x0F,
+	0xC0, 0x1F, 0x00, 0x10, 0xC0, 0x0F, 0xC0, 0x1F, 0x00, 0x10, 0xA8, 0x29,
+	0xC0, 0x07, 0xC0, 0x0F, 0x00, 0x18, 0xC0, 0x0F, 0xC0, 0x07, 0xAA, 0x2A,
+	0xC0, 0x0F, 0xC0, 0x1F, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x18, 0xC0, 0x1F,
+	0xC0, 0x0F, 0xAA, 0x2A, 0x40, 0x10, 0xC0, 0x18, 0x80, 0x0F, 0x00, 0x07,
+	0x80, 0x0F, 0xC0, 0x18, 0x40, 0x10, 0x6A, 0x2A, 0xC0, 0x8F, 0xC0, 0x9F,
+	0x00, 0x90, 0x00, 0xD0, 0xC0, 0x7F, 0xC0, 0x3F, 0xAA, 0x2A, 0xC0, 0x18,
+	0xC0, 0x1C, 0x40, 0x16, 0x40, 0x13, 0xC0, 0x11, 0xC0, 0x18, 0x40, 0x18,
+	0x98, 0x1A, 0x80, 0x00, 0xF0, 0x0F, 0x78, 0x1F, 0x08, 0x10, 0x80, 0x01,
+	0x78, 0x1F, 0x98, 0x1A, 0x08, 0x10, 0x78, 0x1F, 0xF0, 0x0F, 0x80, 0x00,
+	0xAA, 0x2A, 0x10, 0x00, 0x18, 0x00, 0x08, 0x00, 0x18, 0x00, 0x10, 0x00,
+	0x18, 0x00, 0x08, 0x00, 0x00, 0x00, 0x9A, 0x2A, 0x08, 0x10, 0xF8, 0x1F,
+	0x88, 0x10, 0xC8, 0x11, 0x18, 0x18, 0x38, 0x1C, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x29,
+	0x80, 0x0F, 0xC0, 0x1F, 0x40, 0x11, 0xC0, 0x19, 0x80, 0x09, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xAA, 0x2A, 0xC0, 0x1F, 0xE0, 0x1F, 0x30, 0x01, 0x18, 0x01, 0x30, 0x01,
+	0xE0, 0x1F, 0xC0, 0x1F, 0x9A, 0x29, 0x08, 0x10, 0xF8, 0x1F, 0x88, 0x10,
+	0x88, 0x1F, 0x18, 0x0F, 0x9A, 0x29, 0x08, 0x10, 0xF8, 0x1F, 0x88, 0x10,
+	0xF8, 0x1F, 0x70, 0x0F, 0x9A, 0x2A, 0x08, 0x10, 0xF8, 0x1F, 0x08, 0x10,
+	0x08, 0x00, 0x18, 0x00, 0x38, 0x00, 0xAA, 0x2A, 0x00, 0x70, 0xF0, 0x3F,
+	0xF8, 0x1F, 0x08, 0x10, 0xF8, 0x1F, 0xF8, 0x3F, 0x00, 0x70, 0x9A, 0x2A,
+	0x08, 0x10, 0xF8, 0x1F, 0x88, 0x10, 0xC8, 0x11, 0x18, 0x18, 0x38, 0x1C,
+	0xAA, 0x2A, 0x18, 0x18, 0x78, 0x1E, 0x80, 0x01, 0xF8, 0x1F, 0x80, 0x01,
+	0x78, 0x1E, 0x18, 0x18, 0x6A, 0x29, 0x10, 0x08, 0x18, 0x18, 0x88, 0x10,
+	0xF8, 0x1F, 0x70, 0x0F, 0xA6, 0x1A, 0xF8, 0x1F, 0x80, 0x03, 0xC0, 0x01,
+	0xE0, 0x00, 0xF8, 0x1F, 0xAA, 0x2A, 0xF8, 0x1F, 0xFA, 0x1F, 0x84, 0x03,
+	0xC4, 0x01, 0xE4, 0x00, 0xFA, 0x1F, 0xF8, 0x1F, 0x9A, 0x2A, 0x08, 0x10,
+	0xF8, 0x1F, 0x80, 0x01, 0xE0, 0x03, 0x78, 0x1E, 0x18, 0x1C, 0xAA, 0x1A,
+	0x00, 0x10, 0x00, 0x18, 0xF0, 0x0F, 0xF8, 0x07, 0x08, 0x00, 0xF8, 0x1F,
+	0xA6, 0x1A, 0xF8, 0x1F, 0x70, 0x00, 0xE0, 0x00, 0x70, 0x00, 0xF8, 0x1F,
+	0x66, 0x19, 0xF8, 0x1F, 0x80, 0x00, 0xF8, 0x1F, 0xAA, 0x2A, 0xE0, 0x07,
+	0xF0, 0x0F, 0x18, 0x18, 0x08, 0x10, 0x18, 0x18, 0xF0, 0x0F, 0xE0, 0x07,
+	0x66, 0x19, 0xF8, 0x1F, 0x08, 0x00, 0xF8, 0x1F, 0x9A, 0x2A, 0x08, 0x10,
+	0xF8, 0x1F, 0x88, 0x10, 0x88, 0x00, 0xF8, 0x00, 0x70, 0x00, 0xAA, 0x29,
+	0xE0, 0x07, 0xF0, 0x0F, 0x18, 0x18, 0x08, 0x10, 0x18, 0x18, 0x30, 0x0C,
+	0xA8, 0x29, 0x38, 0x00, 0x18, 0x10, 0xF8, 0x1F, 0x18, 0x10, 0x38, 0x00,
+	0x6A, 0x29, 0x78, 0x08, 0xF8, 0x18, 0x80, 0x10, 0xF8, 0x1F, 0xF8, 0x0F,
+	0xAA, 0x2A, 0xE0, 0x01, 0xF0, 0x03, 0x18, 0x16, 0xF8, 0x1F, 0x18, 0x16,
+	0xF0, 0x03, 0xE0, 0x01, 0xAA, 0x2A, 0x18, 0x18, 0x78, 0x1E, 0xE0, 0x07,
+	0x80, 0x01, 0xE0, 0x07, 0x78, 0x1E, 0x18, 0x18, 0x66, 0x2A, 0xF8, 0x1F,
+	0x00, 0x10, 0xF8, 0x1F, 0xF8, 0x3F, 0x00, 0x70, 0x6A, 0x19, 0xF8, 0x00,
+	0xF8, 0x01, 0x00, 0x01, 0xF8, 0x1F, 0xA6, 0x1A, 0xF8, 0x1F, 0x00, 0x10,
+	0xF8, 0x1F, 0x00, 0x10, 0xF8, 0x1F, 0xA6, 0x2A, 0xF8, 0x1F, 0x00, 0x10,
+	0xF8, 0x1F, 0x00, 0x10, 0xF8, 0x1F, 0x00, 0x70, 0x9A, 0x29, 0x08, 0x00,
+	0xF8, 0x1F, 0x80, 0x10, 0x80, 0x1F, 0x00, 0x0F, 0xA6, 0x18, 0xF8, 0x1F,
+	0x80, 0x10, 0x80, 0x1F, 0xF8, 0x1F, 0x98, 0x29, 0xF8, 0x1F, 0x80, 0x10,
+	0x80, 0x1F, 0x00, 0x0F, 0x6A, 0x29, 0x10, 0x08, 0x18, 0x18, 0x88, 0x10,
+	0xF8, 0x1F, 0xF0, 0x0F, 0xA6, 0x26, 0xF8, 0x1F, 0x80, 0x00, 0xF0, 0x0F,
+	0x08, 0x10, 0xF0, 0x0F, 0xAA, 0x1A, 0x70, 0x18, 0xF8, 0x1E, 0x88, 0x07,
+	0x88, 0x01, 0x88, 0x00, 0xF8, 0x1F, 0x6A, 0x2A, 0x00, 0x0E, 0x40, 0x1F,
+	0x40, 0x11, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x10, 0xAA, 0x2A, 0xC0, 0x0F,
+	0xE0, 0x1F, 0xB0, 0x10, 0x90, 0x10, 0x98, 0x10, 0x88, 0x1F, 0x00, 0x0F,
+	0x9A, 0x29, 0x40, 0x10, 0xC0, 0x1F, 0x40, 0x12, 0xC0, 0x1F, 0x80, 0x0D,
+	0x9A, 0x1A, 0x40, 0x10, 0xC0, 0x1F, 0x40, 0x10, 0x40, 0x00, 0xC0, 0x00,
+	0xAA, 0x2A, 0x00, 0x70, 0x80, 0x3F, 0xC0, 0x1F, 0x40, 0x10, 0xC0, 0x1F,
+	0xC0, 0x3F, 0x00, 0x70, 0x6A, 0x29, 0x80, 0x0F, 0xC0, 0x1F, 0x40, 0x11,
+	0xC0, 0x19, 0x80, 0x09, 0xAA, 0x2A, 0x40, 0x10, 0xC0, 0x18, 0x00, 0x07,
+	0xC0, 0x1F, 0x00, 0x07, 0xC0, 0x18, 0x40, 0x10, 0xAA, 0x29, 0x80, 0x08,
+	0xC0, 0x18, 0x40, 0x10, 0x40, 0x12, 0xC0, 0x1F, 0x80, 0x0D, 0xA6, 0x1A,
+	0xC0, 0x1F, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0xC0, 0x1F, 0xAA, 0x2A,
+	0xC0, 0x1F, 0xC8, 0x1F, 0x10, 0x0C, 0x10, 0x06, 0x10, 0x03, 0xC8, 0x1F,
+	0xC0, 0x1F, 0x98, 0x2A, 0xC0, 0x1F, 0x00, 0x07, 0x80, 0x0D, 0xC0, 0x18,
+	0x40, 0x10, 0xAA, 0x1A, 0x00, 0x10, 0x00, 0x18, 0x80, 0x0F, 0xC0, 0x07,
+	0x40, 0x00, 0xC0, 0x1F, 0xA6, 0x1A, 0xC0, 0x1F, 0x80, 0x01, 0x00, 0x03,
+	0x80, 0x01, 0xC0, 0x1F, 0x66, 0x19, 0xC0, 0x1F, 0x00, 0x02, 0xC0, 0x1F,
+	0x6A, 0x29, 0x80, 0x0F, 0xC0, 0x1F, 0x40, 0x10, 0xC0, 0x1F, 0x80, 0x0F,
+	0x66, 0x19, 0xC0, 0x1F, 0x40, 0x00, 0xC0, 0x1F, 0xAA, 0x2A, 0x40, 0x80,
+	0xC0, 0xFF, 0x80, 0xFF, 0x40, 0x90, 0x40, 0x10, 0xC0, 0x1F, 0x80, 0x0F,
+	0x6A, 0x29, 0x80, 0x0F, 0xC0, 0x1F, 0x40, 0x10, 0xC0, 0x18, 0x80, 0x08,
+	0x6A, 0x0A, 0xC0, 0x00, 0x40, 0x10, 0xC0, 0x1F, 0x40, 0x10, 0xC0, 0x00,
+	0x6A, 0x2A, 0xC0, 0x8F, 0xC0, 0x9F, 0x00, 0x90, 0x00, 0xD0, 0xC0, 0x7F,
+	0xC0, 0x3F, 0xAA, 0x2A, 0x80, 0x0F, 0xC0, 0x1F, 0x40, 0x90, 0xF8, 0xFF,
+	0x40, 0x90, 0xC0, 0x1F, 0x80, 0x0F, 0xAA, 0x2A, 0x40, 0x10, 0xC0, 0x18,
+	0x80, 0x0F, 0x00, 0x07, 0x80, 0x0F, 0xC0, 0x18, 0x40, 0x10, 0x66, 0x2A,
+	0xC0, 0x1F, 0x00, 0x10, 0xC0, 0x1F, 0xC0, 0x3F, 0x00, 0x70, 0x6A, 0x19,
+	0xC0, 0x01, 0xC0, 0x03, 0x00, 0x02, 0xC0, 0x1F, 0xA6, 0x1A, 0xC0, 0x1F,
+	0x00, 0x10, 0xC0, 0x1F, 0x00, 0x10, 0xC0, 0x1F, 0xA6, 0x2A, 0xC0, 0x1F,
+	0x00, 0x10, 0xC0, 0x1F, 0x00, 0x10, 0xC0, 0x1F, 0x00, 0x70, 0x9A, 0x29,
+	0x40, 0x00, 0xC0, 0x1F, 0x00, 0x12, 0x00, 0x1E, 0x00, 0x0C, 0xA6, 0x18,
+	0xC0, 0x1F, 0x00, 0x12, 0x00, 0x1E, 0xC0, 0x1F, 0x98, 0x29, 0xC0, 0x1F,
+	0x00, 0x12, 0x00, 0x1E, 0x00, 0x0C, 0x6A, 0x29, 0x80, 0x08, 0xC0, 0x18,
+	0x40, 0x12, 0xC0, 0x1F, 0x80, 0x0F, 0xA6, 0x26, 0xC0, 0x1F, 0x00, 0x02,
+	0x80, 0x0F, 0x40, 0x10, 0x80, 0x0F, 0xAA, 0x1A, 0x80, 0x11, 0xC0, 0x1B,
+	0x40, 0x0E, 0x40, 0x06, 0x40, 0x02, 0xC0, 0x1F,
+};
+
+static const uint16_t FontBigBlocks[32] = {
+	0, 0, 0, 0, 16, 102, 178, 288,
+	374, 486, 586, 702, 794, 900, 998, 1118,
+	0, 0, 0, 0, 0, 1206, 0, 1234,
+	1260, 1372, 1472, 1578, 1674, 1786, 1880, 1988,
+};
+
+const FONT_Packed_t gFontBig = {
+	FontBigData,
+	FontBigBlocks,
+	256,
+	8,
+	2,
+};
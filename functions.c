@@ -16,9 +16,8 @@
 
 #include "functions.h"
 
-#include <string.h>
-
 #include "app/dtmf.h"
+#include "app/uart.h"
 #include "bsp/dp32g030/gpio.h"
 #include "dcs.h"
 #include "driver/bk4819.h"
@@ -43,8 +42,7 @@ void FUNCTION_Init(void) {
         }
     }
     gDTMF_RequestPending = false;
-    gDTMF_WriteIndex = 0;
-    memset(gDTMF_Received, 0, sizeof(gDTMF_Received));
+    DTMF_ClearReceived();
     g_CxCSS_TAIL_Found = false;
     g_CDCSS_Lost = false;
     g_CTCSS_Lost = false;
@@ -71,6 +69,11 @@ void FUNCTION_Select(FUNCTION_Type_t Function) {
 
     if (bWasPowerSave) {
         if (Function != FUNCTION_POWER_SAVE) {
+            // Mid-frame the clock is restored by APP_UpdateClock() once the
+            // frame is in
+            if (UART_IsRxIdle()) {
+                SYSTEM_SetClockProfile(SYSTEM_CLOCK_PROFILE_48MHZ);
+            }
             BK4819_Conditional_RX_TurnOn_and_GPIO6_Enable();
             gRxIdleMode = false;
             UI_DisplayStatus();
@@ -101,7 +104,7 @@ void FUNCTION_Select(FUNCTION_Type_t Function) {
             break;
 
         case FUNCTION_POWER_SAVE:
-            gBatterySave = gEeprom.BATTERY_SAVE * 10;
+            gBatterySave = BATTERY_GetSaveTime();
             gRxIdleMode = true;
             BK4819_DisableVox();
             BK4819_Sleep();
@@ -28,6 +28,8 @@ enum FUNCTION_Type_t {
 	FUNCTION_POWER_SAVE = 5U,
 };
 
+#define FUNCTION_COUNT 6U
+
 typedef enum FUNCTION_Type_t FUNCTION_Type_t;
 
 extern FUNCTION_Type_t gCurrentFunction;
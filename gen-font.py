@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+
+# Packs glyph tables into one font for FONT_Decode() in font.c, indexed by
+# character code, and reports the flash saved. Codes that no table covers
+# become blank glyphs, which only take their header.
+# Each glyph starts with 2 bits per column: 0 for a blank column, 1 for the
+# same column as the one on its left and 2 for a literal column, which then
+# follows with one byte per page. A table of offsets for every BLOCK_SIZE
+# glyphs keeps the lookup short, blocks that pack to the same bytes, such as
+# runs of blank codes, are stored once. An alias <code>=<source code> copies
+# the glyph of one code to another, after all tables are placed.
+#
+# With --report it prints the flash the packed font takes with its decoder
+# against the tables it was packed from, using the size tool of the build.
+#
+# Usage: gen-font.py <output.c> <name> <table.inc>:<first code>... [<code>=<source code>]...
+#        gen-font.py --report <size tool> <output.c> <decoder.o> <output.o>
+
+import re
+import subprocess
+import sys
+
+BLOCK_SIZE = 8
+
+HEADER = '''/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Generated by gen-font.py from {0}, do not edit.
+// {1} bytes unpacked.
+
+#include "font.h"
+'''
+
+def load_table(path):
+    source = open(path, encoding='latin-1').read()
+    table = re.search(r'const uint8_t (\w+)\[(\d+)\]\[(\d+)\] = \{(.*?)\n\};', source, re.S)
+    if table is None:
+        sys.exit(f'{path}: no glyph table found')
+    name, count, size = table.group(1), int(table.group(2)), int(table.group(3))
+    values = [int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{2})', table.group(4))]
+    if len(values) != count * size:
+        sys.exit(f'{path}: {name} has {len(values)} bytes instead of {count * size}')
+    # 16 byte glyphs are 8 columns on two pages, anything else a single page
+    pages = 2 if size == 16 else 1
+    return name, pages, size // pages, [values[i * size:(i + 1) * size] for i in range(count)]
+
+def pack_glyph(glyph, pages, width):
+    header = [0] * ((width + 3) // 4)
+    literals = []
+    previous = (0,) * pages
+    for x in range(width):
+        column = tuple(glyph[page * width + x] for page in range(pages))
+        if not any(column):
+            code = 0
+        elif column == previous:
+            code = 1
+        else:
+            code = 2
+            literals += column
+        header[x // 4] |= code << ((x % 4) * 2)
+        previous = column
+    return header + literals
+
+def hex_lines(data):
+    for i in range(0, len(data), 12):
+        yield '\t' + ' '.join(f'0x{x:02X},' for x in data[i:i + 12])
+
+def section_sizes(size, path):
+    sizes = {}
+    output = subprocess.run([size, '-A', path], capture_output=True, text=True, check=True).stdout
+    for line in output.splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[0].startswith('.') and fields[1].isdigit():
+            sizes[fields[0]] = int(fields[1])
+    return sizes
+
+def report(size, output, decoder, table):
+    plain = re.search(r'// (\d+) bytes unpacked', open(output).read())
+    if plain is None:
+        sys.exit(f'{output}: no unpacked size, regenerate it')
+    plain = int(plain.group(1))
+    code = section_sizes(size, decoder)
+    packed = sum(n for section, n in section_sizes(size, table).items() if section in ('.text', '.rodata', '.data'))
+    flash = packed + code.get('.text', 0)
+    print(f'{output}: {packed} bytes packed + {code.get(".text", 0)} bytes of decoder = {flash}, '
+          f'{plain} unpacked, {plain - flash} saved, {code.get(".bss", 0)} bytes of RAM')
+
+if len(sys.argv) == 6 and sys.argv[1] == '--report':
+    report(*sys.argv[2:])
+    sys.exit(0)
+
+if len(sys.argv) < 4:
+    sys.exit(f'Usage: {sys.argv[0]} <output.c> <name> <table.inc>:<first code>... [<code>=<source code>]...')
+
+output, name = sys.argv[1:3]
+prefix = name[1:] if name.startswith('g') else name
+inputs = []
+aliases = []
+glyphs = [None] * 256
+pages = width = None
+for arg in sys.argv[3:]:
+    if '=' in arg:
+        code, _, source = arg.partition('=')
+        aliases.append((int(code, 0), int(source, 0)))
+        continue
+    path, _, first = arg.rpartition(':')
+    first = int(first, 0)
+    table, table_pages, table_width, table_glyphs = load_table(path)
+    if pages is not None and (table_pages, table_width) != (pages, width):
+        sys.exit(f'{path}: {table} does not have the glyph size of the other tables')
+    pages, width = table_pages, table_width
+    if first + len(table_glyphs) > 256:
+        sys.exit(f'{path}: {table} runs past code 255')
+    glyphs[first:first + len(table_glyphs)] = table_glyphs
+    inputs.append((path, table, len(table_glyphs)))
+
+for code, source in aliases:
+    if glyphs[source] is None:
+        sys.exit(f'{code:#04x}={source:#04x}: no glyph at {source:#04x}')
+    glyphs[code] = glyphs[source]
+
+data = []
+blocks = []
+for i in range(0, len(glyphs), BLOCK_SIZE):
+    block = []
+    for glyph in glyphs[i:i + BLOCK_SIZE]:
+        block += pack_glyph(glyph or [0] * (pages * width), pages, width)
+    for offset in blocks:
+        if data[offset:offset + len(block)] == block:
+            break
+    else:
+        offset = len(data)
+        data += block
+    blocks.append(offset)
+
+plain = sum(count for *_, count in inputs) * width * pages
+with open(output, 'w', newline='\n') as f:
+    f.write(HEADER.format(', '.join(path for path, *_ in inputs), plain))
+    f.write(f'\nstatic const uint8_t {prefix}Data[{len(data)}] = {{\n')
+    f.write('\n'.join(hex_lines(data)))
+    f.write(f'\n}};\n\nstatic const uint16_t {prefix}Blocks[{len(blocks)}] = {{\n')
+    for i in range(0, len(blocks), 8):
+        f.write('\t' + ' '.join(f'{x},' for x in blocks[i:i + 8]) + '\n')
+    f.write(f'}};\n\nconst FONT_Packed_t {name} = {{\n')
+    f.write(f'\t{prefix}Data,\n\t{prefix}Blocks,\n\t{len(glyphs)},\n\t{width},\n\t{pages},\n}};\n')
+
+packed = len(data) + len(blocks) * 2
+print(f'{name}: ' + ', '.join(f'{table} {count}' for _, table, count in inputs) + ' glyphs')
+print(f'{name}: {plain} -> {packed} bytes, {plain - packed} saved')
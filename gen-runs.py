@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+
+# Lays out the constant strings of a .def file with gFontBig, the same way
+# UI_PrintString() does, so they can be copied with one memcpy per page.
+#
+# Usage: gen-runs.py <runs.def> <font_big.inc> <output base>
+
+import re
+import sys
+
+HEADER = '''/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Generated by gen-runs.py from {0}, do not edit.
+
+'''
+
+def load_font(path):
+    source = open(path).read()
+    body = re.search(r'gFontBig\[95\]\[16\] = \{(.*?)\n\};', source, re.S)
+    if body is None:
+        sys.exit(f'{path}: gFontBig not found')
+    values = [int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{2})', body.group(1))]
+    return [values[i * 16:(i + 1) * 16] for i in range(95)]
+
+def load_runs(path):
+    runs = []
+    layout = None
+    for number, line in enumerate(open(path), 1):
+        line = line.strip()
+        if not line or line.startswith('#'):
+            continue
+        if line.startswith('['):
+            layout = None
+            continue
+        name, _, value = [x.strip() for x in line.partition('=')]
+        if name == '$':
+            layout = [int(x) for x in value.split(',')]
+        elif layout is None:
+            sys.exit(f'{path}:{number}: entry before the section layout')
+        else:
+            runs.append((name, value, layout))
+    return runs
+
+def render(font, text, start, end, width, centered):
+    length = len(text)
+    if centered:
+        start += ((end - start) - (length * width) + 1) // 2
+    columns = [(0, 0)] * (length * width)
+    for i, c in enumerate(text):
+        index = ord(c) - 32
+        if 0 <= index < 95:
+            glyph = font[index]
+            for x in range(8):
+                columns[i * width + x] = (glyph[x], glyph[8 + x])
+    # Blank columns on either side are already cleared in gFrameBuffer
+    while columns and columns[-1] == (0, 0):
+        columns.pop()
+    while columns and columns[0] == (0, 0):
+        columns.pop(0)
+        start += 1
+    if start < 0 or start + len(columns) > 128:
+        sys.exit(f'"{text}" does not fit on the screen')
+    return start, columns
+
+def hex_lines(data):
+    for i in range(0, len(data), 12):
+        yield '\t' + ' '.join(f'0x{x:02X},' for x in data[i:i + 12])
+
+if len(sys.argv) != 4:
+    sys.exit(f'Usage: {sys.argv[0]} <runs.def> <font_big.inc> <output base>')
+
+font = load_font(sys.argv[2])
+runs = load_runs(sys.argv[1])
+base = sys.argv[3]
+guard = re.sub(r'\W', '_', base).upper() + '_H'
+
+data = []
+table = []
+for name, text, layout in runs:
+    start, columns = render(font, text, *layout)
+    table.append((name, text, len(data), start, len(columns)))
+    data += [c[0] for c in columns] + [c[1] for c in columns]
+
+with open(base + '.h', 'w', newline='\n') as f:
+    f.write(HEADER.format(sys.argv[1]))
+    f.write(f'#ifndef {guard}\n#define {guard}\n\n#include <stdint.h>\n\n')
+    f.write('typedef struct {\n\tuint16_t Offset;\n\tuint8_t Start;\n\tuint8_t Columns;\n} UI_Run_t;\n\n')
+    f.write('enum UI_RUN_ID {\n')
+    for i, (name, text, *_) in enumerate(table):
+        f.write(f'\tUI_RUN_{name}{" = 0" if i == 0 else ""},\n')
+    f.write('};\n\ntypedef enum UI_RUN_ID UI_RUN_ID;\n\n')
+    f.write(f'extern const UI_Run_t gRuns[{len(table)}];\n')
+    f.write(f'extern const uint8_t gRunData[{len(data)}];\n\n#endif\n\n')
+
+with open(base + '.c', 'w', newline='\n') as f:
+    f.write(HEADER.format(sys.argv[1]))
+    f.write(f'#include "{base}.h"\n\n')
+    f.write(f'const UI_Run_t gRuns[{len(table)}] = {{\n')
+    for name, text, offset, start, columns in table:
+        f.write(f'\t{{ {offset:4d}, {start:3d}, {columns:3d} }}, // {text}\n')
+    f.write('};\n\n')
+    f.write(f'const uint8_t gRunData[{len(data)}] = {{\n')
+    f.write('\n'.join(hex_lines(data)))
+    f.write('\n};\n\n')
+
+print(f'{base}.c: {len(table)} runs, {len(data) + len(table) * 4} bytes')
@@ -15,8 +15,10 @@
  */
 
 #include "battery.h"
+#include "board.h"
 #include "driver/backlight.h"
 #include "misc.h"
+#include "settings.h"
 #include "ui/battery.h"
 #include "ui/menu.h"
 #include "ui/ui.h"
@@ -25,7 +27,6 @@
 uint16_t gBatteryCalibration[6];
 uint16_t gBatteryCurrentVoltage;
 uint16_t gBatteryCurrent;
-uint16_t gBatteryVoltages[4];
 uint16_t gBatteryVoltageAverage;
 
 uint8_t gBatteryDisplayLevel;
@@ -38,6 +39,73 @@ volatile uint16_t gBatterySave;
 
 uint16_t gBatteryCheckCounter;
 
+// Single pole IIR with a weight of 1/8 per sample, kept with 4 fractional
+// bits so the voltmeter does not flicker on the last digit.
+#define BATTERY_FILTER_SHIFT	3
+#define BATTERY_FILTER_FRACTION	4
+
+// Readings averaged to start the filter at boot, where the power save
+// decision is taken on the first value
+#define BATTERY_PRIME_SAMPLES	4U
+
+static uint32_t VoltageFilter;
+
+// In adaptive battery save, the sleep window starts at BATTERY_SAVE_MIN ticks
+// after squelch last opened and doubles for every BATTERY_SAVE_STEP of quiet
+// channel, up to BATTERY_SAVE_MAX. The receiver is always woken for 10 ticks.
+#define BATTERY_SAVE_MIN	5U
+#define BATTERY_SAVE_MAX	80U
+#define BATTERY_SAVE_STEP	3000U
+
+static uint32_t LastActivity;
+
+void BATTERY_Sample(void)
+{
+	uint32_t Sample;
+
+	BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage, &gBatteryCurrent);
+	Sample = (uint32_t)gBatteryCurrentVoltage << BATTERY_FILTER_FRACTION;
+	if (VoltageFilter == 0) {
+		VoltageFilter = Sample;
+	} else {
+		VoltageFilter += (Sample >> BATTERY_FILTER_SHIFT) - (VoltageFilter >> BATTERY_FILTER_SHIFT);
+	}
+}
+
+void BATTERY_Prime(void)
+{
+	uint32_t Sum = 0;
+	uint8_t i;
+
+	for (i = 0; i < BATTERY_PRIME_SAMPLES; i++) {
+		BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage, &gBatteryCurrent);
+		Sum += gBatteryCurrentVoltage;
+	}
+	VoltageFilter = (Sum << BATTERY_FILTER_FRACTION) / BATTERY_PRIME_SAMPLES;
+}
+
+void BATTERY_NoteActivity(void)
+{
+	LastActivity = gGlobalSysTickCounter;
+}
+
+uint16_t BATTERY_GetSaveTime(void)
+{
+	uint32_t Steps;
+	uint16_t Time;
+
+	if (gEeprom.BATTERY_SAVE != BATTERY_SAVE_ADAPTIVE) {
+		return gEeprom.BATTERY_SAVE * 10;
+	}
+
+	Steps = (gGlobalSysTickCounter - LastActivity) / BATTERY_SAVE_STEP;
+	for (Time = BATTERY_SAVE_MIN; Steps && Time < BATTERY_SAVE_MAX; Steps--) {
+		Time <<= 1;
+	}
+
+	return Time;
+}
+
 void BATTERY_GetReadings(bool bDisplayBatteryLevel)
 {
 	uint16_t Voltage;
@@ -45,7 +113,7 @@ void BATTERY_GetReadings(bool bDisplayBatteryLevel)
 
 	PreviousBatteryLevel = gBatteryDisplayLevel;
 
-	Voltage = (gBatteryVoltages[0] + gBatteryVoltages[1] + gBatteryVoltages[2] + gBatteryVoltages[3]) / 4;
+	Voltage = (VoltageFilter + (1U << (BATTERY_FILTER_FRACTION - 1))) >> BATTERY_FILTER_FRACTION;
 
 	if (gBatteryCalibration[5] < Voltage) {
 		gBatteryDisplayLevel = 6;
@@ -63,7 +131,7 @@ void BATTERY_GetReadings(bool bDisplayBatteryLevel)
 		gBatteryDisplayLevel = 0;
 	}
 
-	gBatteryVoltageAverage = (Voltage * 760) / gBatteryCalibration[3];
+	gBatteryVoltageAverage = ((VoltageFilter * 760) + ((uint32_t)gBatteryCalibration[3] << (BATTERY_FILTER_FRACTION - 1))) / ((uint32_t)gBatteryCalibration[3] << BATTERY_FILTER_FRACTION);
 
 	if ((gScreenToDisplay == DISPLAY_MENU) && gMenuCursor == MENU_VOL) {
 		gUpdateDisplay = true;
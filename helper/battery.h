@@ -20,10 +20,12 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// BATTERY_SAVE values 1 to 4 are fixed ratios, 5 follows channel activity
+#define BATTERY_SAVE_ADAPTIVE 5U
+
 extern uint16_t gBatteryCalibration[6];
 extern uint16_t gBatteryCurrentVoltage;
 extern uint16_t gBatteryCurrent;
-extern uint16_t gBatteryVoltages[4];
 extern uint16_t gBatteryVoltageAverage;
 
 extern uint8_t gBatteryDisplayLevel;
@@ -36,6 +38,10 @@ extern volatile uint16_t gBatterySave;
 
 extern uint16_t gBatteryCheckCounter;
 
+void BATTERY_Sample(void);
+void BATTERY_Prime(void);
+void BATTERY_NoteActivity(void);
+uint16_t BATTERY_GetSaveTime(void);
 void BATTERY_GetReadings(bool bDisplayBatteryLevel);
 
 #endif
@@ -14,11 +14,9 @@
  *     limitations under the License.
  */
 
-#include "bsp/dp32g030/gpio.h"
 #include "driver/bk4819.h"
 #include "driver/keyboard.h"
-#include "driver/gpio.h"
-#include "driver/system.h"
+#include "driver/systick.h"
 #include "helper/boot.h"
 #include "misc.h"
 #include "radio.h"
@@ -26,23 +24,28 @@
 #include "ui/menu.h"
 #include "ui/ui.h"
 
+// The combination has to read the same on two scans 1ms apart, with PTT held
 BOOT_Mode_t BOOT_GetMode(void)
 {
-	KEY_Code_t Keys[2];
+	uint32_t Keys[2];
 	uint8_t i;
 
 	for (i = 0; i < 2; i++) {
-		if (GPIO_CheckBit(&GPIOC->DATA, GPIOC_PIN_PTT)) {
+		if (i) {
+			SYSTICK_DelayUs(1000);
+		}
+		Keys[i] = KEYBOARD_Scan();
+		if (!(Keys[i] & KEYBOARD_MASK(KEY_PTT))) {
 			return BOOT_MODE_NORMAL;
 		}
-		Keys[i] = KEYBOARD_Poll();
-		SYSTEM_DelayMs(20);
 	}
 	if (Keys[0] == Keys[1]) {
-		gKeyReading0 = Keys[0];
-		gKeyReading1 = Keys[0];
+		const KEY_Code_t Key = KEYBOARD_GetKey(Keys[0]);
+
+		gKeyReading0 = Key;
+		gKeyReading1 = Key;
 		gDebounceCounter = 2;
-		if (Keys[0] == KEY_SIDE1) {
+		if (Key == KEY_SIDE1) {
 			return BOOT_MODE_F_LOCK;
 		}
 	}
@@ -0,0 +1,62 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include "energy.h"
+#include "bsp/dp32g030/gpio.h"
+#include "driver/bk4819.h"
+#include "driver/gpio.h"
+#include "driver/system.h"
+#include "driver/systick.h"
+#include "misc.h"
+#include "radio.h"
+#include "settings.h"
+
+ENERGY_Stats_t gEnergy;
+
+void ENERGY_TimeSlice10ms(void)
+{
+	gEnergy.Ticks++;
+	gEnergy.Function[gCurrentFunction]++;
+	if (gRxIdleMode) {
+		gEnergy.RxIdle++;
+	}
+	if (BK4819_IsSleeping()) {
+		gEnergy.RadioSleep++;
+	}
+	if (GPIO_CheckBit(&GPIOB->DATA, GPIOB_PIN_BACKLIGHT)) {
+		gEnergy.Backlight++;
+	}
+	if (gCurrentFunction == FUNCTION_TRANSMIT && gTxVfo->OUTPUT_POWER <= OUTPUT_POWER_HIGH) {
+		gEnergy.TxPower[gTxVfo->OUTPUT_POWER]++;
+	}
+	if (SYSTEM_GetClockMHz() != 48U) {
+		gEnergy.ClockSlow++;
+	}
+}
+
+// The CPU never sleeps, so this is not an idle split. APP_Update() and the
+// time slices count as busy from Start, a SYSTICK_GetTimestamp(), to now,
+// the rest of the main loop as polling. An interval that comes out negative
+// is dropped rather than wrapping into a huge one.
+void ENERGY_AddBusy(uint32_t Start)
+{
+	const int32_t Busy = (int32_t)(SYSTICK_GetTimestamp() - Start);
+
+	if (Busy > 0) {
+		gEnergy.BusyUs += Busy;
+	}
+}
+
@@ -0,0 +1,45 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef ENERGY_H
+#define ENERGY_H
+
+#include <stdint.h>
+#include "functions.h"
+
+// Counters are in ticks of 10ms, except BusyUs, the time in APP_Update() and
+// the time slices. The CPU never sleeps, the rest of the time it polls. Each
+// state is counted on its own, so a tick in power save with the radio asleep
+// and the backlight off adds to Function[FUNCTION_POWER_SAVE], RxIdle and
+// RadioSleep.
+typedef struct {
+	uint32_t Ticks;
+	uint32_t Function[FUNCTION_COUNT];
+	uint32_t RxIdle;
+	uint32_t RadioSleep;
+	uint32_t Backlight;
+	uint32_t TxPower[3];
+	uint32_t ClockSlow;
+	uint32_t BusyUs;
+} ENERGY_Stats_t;
+
+extern ENERGY_Stats_t gEnergy;
+
+void ENERGY_TimeSlice10ms(void);
+void ENERGY_AddBusy(uint32_t Start);
+
+#endif
+
@@ -0,0 +1,241 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Checks the loop counts SYSTICK_DelayNs() folds for the delays in use
+// against what the buses need. Loops take 4 * Loops - 2 cycles on the M0
+// without wait states, the shortest a delay can be. Each one has to cover
+// the request at 48MHz and overshoot by less than one loop.
+//
+// The BK4819 and EEPROM drivers then run against counting GPIO and delay
+// calls, which gives the cycles of a register write and of an EEPROM byte,
+// and from them the rates with these delays and with the SYSTICK_DelayUs(1)
+// that every delay used to be. Code between the calls is left out, so both
+// rates are upper bounds.
+
+#include <stdio.h>
+#include "driver/bk4819.h"
+#include "driver/eeprom.h"
+#include "driver/gpio.h"
+#include "driver/i2c.h"
+#include "driver/keyboard.h"
+#include "driver/system.h"
+#include "driver/systick.h"
+
+// 400kHz Fast-mode, SCL is low for two delays and high for one
+#define I2C_LOW_MIN_NS		1300U
+#define I2C_HIGH_MIN_NS		600U
+
+// A GPIO_SetBit() call at -Os: the arguments, BL, LDR, LSLS, ORRS, STR, BX
+#define GPIO_CYCLES		16U
+
+// SYSTICK_DelayUs(1): 48 cycles of SysTick, the call and the loop on VAL
+#define DELAY_US_CYCLES		77U
+
+typedef struct {
+	const char *pName;
+	uint32_t Delay;
+} Delay_t;
+
+static const Delay_t Delays[] = {
+	{ "BK4819_DELAY_NS", BK4819_DELAY_NS },
+	{ "I2C_DELAY_NS", I2C_DELAY_NS },
+	{ "KEYBOARD_SETTLE_NS", KEYBOARD_SETTLE_NS },
+};
+
+static const uint8_t Clocks[] = { 48, 12 };
+
+static uint32_t GetCycles(uint32_t Delay)
+{
+	return (4U * SYSTICK_DELAY_LOOPS(Delay)) - 2U;
+}
+
+static uint32_t GetNs(uint32_t Delay, uint8_t MHz)
+{
+	return (GetCycles(Delay) * 1000U) / MHz;
+}
+
+typedef struct {
+	uint32_t Delays;
+	uint32_t DelayCycles;
+	uint32_t GpioOps;
+} Count_t;
+
+static Count_t Count;
+
+void GPIO_ClearBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	*pReg &= ~(1U << Bit);
+	Count.GpioOps++;
+}
+
+// Every input reads low: the EEPROM acknowledges at once and sends zeros
+uint8_t GPIO_CheckBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	Count.GpioOps++;
+
+	return 0;
+}
+
+void GPIO_FlipBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	*pReg ^= 1U << Bit;
+	Count.GpioOps++;
+}
+
+void GPIO_SetBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	*pReg |= 1U << Bit;
+	Count.GpioOps++;
+}
+
+void SYSTICK_DelayNs(uint32_t Delay)
+{
+	Count.Delays++;
+	Count.DelayCycles += GetCycles(Delay);
+}
+
+void SYSTICK_DelayUs(uint32_t Delay)
+{
+}
+
+void SYSTEM_DelayMs(uint32_t Delay)
+{
+}
+
+typedef struct {
+	const char *pName;
+	const char *pUnit;
+	void (*pRun)(void);
+	uint8_t Units;
+} Transfer_t;
+
+static void WriteRegister(void)
+{
+	BK4819_WriteRegister(BK4819_REG_30, 0xBFF1);
+}
+
+static void ReadEeprom(void)
+{
+	uint8_t Buffer[16];
+
+	EEPROM_ReadBuffer(0x0E70, Buffer, sizeof(Buffer));
+}
+
+// Wire time with the ready poll after the previous page, the write cycle
+// itself is the same either way
+static void WriteEeprom(void)
+{
+	static const uint8_t Buffer[8];
+
+	EEPROM_WritePage(0x0E70, Buffer, sizeof(Buffer));
+}
+
+static const Transfer_t Transfers[] = {
+	{ "BK4819 write", "writes/s", WriteRegister, 1 },
+	{ "EEPROM read 16", "bytes/s", ReadEeprom, 16 },
+	{ "EEPROM write 8", "bytes/s", WriteEeprom, 8 },
+};
+
+static uint32_t GetRate(uint32_t Cycles, uint8_t Units)
+{
+	return (uint32_t)(((uint64_t)SYSTICK_CPU_MHZ * 1000000U * Units) / Cycles);
+}
+
+static int CheckTransfers(void)
+{
+	int Failures = 0;
+	uint8_t i;
+
+	printf("\n%-16s %6s %5s %10s %10s %9s %9s\n", "transfer", "delays", "gpio", "old cycles", "new cycles", "old rate", "new rate");
+
+	for (i = 0; i < sizeof(Transfers) / sizeof(Transfers[0]); i++) {
+		uint32_t Old;
+		uint32_t New;
+
+		Transfers[i].pRun();
+		Count.Delays = 0;
+		Count.DelayCycles = 0;
+		Count.GpioOps = 0;
+		Transfers[i].pRun();
+
+		Old = (Count.Delays * DELAY_US_CYCLES) + (Count.GpioOps * GPIO_CYCLES);
+		New = Count.DelayCycles + (Count.GpioOps * GPIO_CYCLES);
+
+		printf("%-16s %6u %5u %10u %10u %9u %9u %s\n", Transfers[i].pName, Count.Delays, Count.GpioOps, Old, New,
+			GetRate(Old, Transfers[i].Units), GetRate(New, Transfers[i].Units), Transfers[i].pUnit);
+
+		if (New >= Old) {
+			printf("FAIL %s: %u cycles, no faster than %u\n", Transfers[i].pName, New, Old);
+			Failures++;
+		}
+	}
+
+	return Failures;
+}
+
+int main(void)
+{
+	int Failures = 0;
+	uint8_t i;
+	uint8_t j;
+
+	printf("%-20s %6s %6s %7s", "delay", "ns", "loops", "cycles");
+	for (j = 0; j < sizeof(Clocks); j++) {
+		printf("  ns@%uMHz", Clocks[j]);
+	}
+	printf("\n");
+
+	for (i = 0; i < sizeof(Delays) / sizeof(Delays[0]); i++) {
+		const uint32_t Delay = Delays[i].Delay;
+		const uint32_t Needed = ((Delay * SYSTICK_CPU_MHZ) + 999U) / 1000U;
+		const uint32_t Cycles = GetCycles(Delay);
+
+		printf("%-20s %6u %6u %7u", Delays[i].pName, Delay, SYSTICK_DELAY_LOOPS(Delay), Cycles);
+		for (j = 0; j < sizeof(Clocks); j++) {
+			printf(" %9u", GetNs(Delay, Clocks[j]));
+		}
+		printf("\n");
+
+		if (Cycles < Needed) {
+			printf("FAIL %s: %u cycles, %u needed\n", Delays[i].pName, Cycles, Needed);
+			Failures++;
+		}
+		if (Cycles >= Needed + 4U) {
+			printf("FAIL %s: %u cycles, more than a loop over %u\n", Delays[i].pName, Cycles, Needed);
+			Failures++;
+		}
+	}
+
+	if (2U * GetNs(I2C_DELAY_NS, SYSTICK_CPU_MHZ) < I2C_LOW_MIN_NS) {
+		printf("FAIL I2C low period under %uns\n", I2C_LOW_MIN_NS);
+		Failures++;
+	}
+	if (GetNs(I2C_DELAY_NS, SYSTICK_CPU_MHZ) < I2C_HIGH_MIN_NS) {
+		printf("FAIL I2C high period under %uns\n", I2C_HIGH_MIN_NS);
+		Failures++;
+	}
+
+	Failures += CheckTransfers();
+
+	if (Failures) {
+		printf("%d checks failed\n", Failures);
+		return 1;
+	}
+	printf("All checks passed\n");
+
+	return 0;
+}
+
@@ -0,0 +1,132 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Per glyph cost of the packed big font: FONT_Decode() on a cache miss,
+// FONT_GetBig() on a hit, and the 16 byte copy from an unpacked table that
+// UI_PrintString() used to do. Every code is first decoded and compared
+// with the tables gen-font.py packed. The times are host times, only the
+// ratios carry over to the M0.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "font.h"
+#include "host.h"
+
+// The generator inputs, under names that do not clash with the packed font
+#define gFontBig PlainFontBig
+#include "font_big.inc"
+#undef gFontBig
+#include "win1251/font_big_cyrillic.inc"
+
+#define BENCH_MIN_NS	50000000U
+#define BENCH_RUNS	5U
+
+static uint8_t Plain[256][16];
+static volatile uint32_t Sink;
+
+static void Decode(uint8_t Code)
+{
+	uint8_t Glyph[16];
+
+	FONT_Decode(&gFontBig, Code, Glyph);
+	Sink += Glyph[0];
+}
+
+static void Lookup(uint8_t Code)
+{
+	Sink += FONT_GetBig('0' + (Code % 10))[0];
+}
+
+static void Copy(uint8_t Code)
+{
+	uint8_t Glyph[16];
+
+	memcpy(Glyph, Plain[Code], sizeof(Glyph));
+	Sink += Glyph[0];
+}
+
+static double TimeOnce(void (*pFunction)(uint8_t))
+{
+	const uint64_t Start = HOST_GetNs();
+	uint64_t Elapsed;
+	uint32_t Calls = 0;
+
+	do {
+		uint16_t i;
+
+		for (i = 0; i < 256; i++) {
+			pFunction(i);
+		}
+		Calls += 256;
+		Elapsed = HOST_GetNs() - Start;
+	} while (Elapsed < BENCH_MIN_NS);
+
+	return (double)Elapsed / Calls;
+}
+
+// Best of a few runs, the host is not otherwise idle
+static double Time(void (*pFunction)(uint8_t))
+{
+	double Best = TimeOnce(pFunction);
+	uint8_t i;
+
+	for (i = 1; i < BENCH_RUNS; i++) {
+		const double Run = TimeOnce(pFunction);
+
+		if (Run < Best) {
+			Best = Run;
+		}
+	}
+
+	return Best;
+}
+
+int main(void)
+{
+	double Decoded;
+	double Cached;
+	double Copied;
+	uint16_t i;
+
+	// Same placement and aliases as the font_packed.c rule in the Makefile
+	memcpy(Plain[0x20], PlainFontBig, sizeof(PlainFontBig));
+	memcpy(Plain[0xC0], gFontBigCyrillic, sizeof(gFontBigCyrillic));
+	memcpy(Plain[0xA8], Plain[0xC5], sizeof(Plain[0]));
+	memcpy(Plain[0xB8], Plain[0xE5], sizeof(Plain[0]));
+
+	for (i = 0; i < 256; i++) {
+		uint8_t Glyph[16];
+
+		FONT_Decode(&gFontBig, i, Glyph);
+		if (memcmp(Glyph, Plain[i], sizeof(Glyph))) {
+			printf("FAIL glyph 0x%02X does not match its table\n", i);
+			return 1;
+		}
+	}
+
+	Decoded = Time(Decode);
+	Cached = Time(Lookup);
+	Copied = Time(Copy);
+
+	printf("%-8s %8s %10s\n", "glyph", "ns", "16 chars");
+	printf("%-8s %8.1f %10.1f\n", "decode", Decoded, Decoded * 16);
+	printf("%-8s %8.1f %10.1f\n", "cached", Cached, Cached * 16);
+	printf("%-8s %8.1f %10.1f\n", "copy", Copied, Copied * 16);
+	printf("decode is %.1fx a copy, a cached glyph %.1fx\n", Decoded / Copied, Cached / Copied);
+
+	return 0;
+}
@@ -0,0 +1,195 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Per call cost of the UI_Format* helpers against the sprintf calls they
+// replaced, over the values each screen shows. Every result is compared with
+// the sprintf output first. sprintf is the one from external/printf when the
+// submodule is checked out, as in the firmware, otherwise the host libc's.
+// The host divides in hardware, so the gap is smaller here than on the M0.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "host.h"
+#include "ui/helper.h"
+#ifdef HOST_PRINTF
+#include "external/printf/printf.h"
+// Only sprintf is compared, the results still go to stdout
+#undef printf
+#endif
+
+#define BENCH_VALUES	4096U
+#define BENCH_MIN_NS	50000000U
+#define BENCH_RUNS	5U
+
+typedef struct {
+	const char *pName;
+	uint32_t First;
+	uint32_t Step;
+	void (*pFormat)(char *pString, uint32_t Value);
+	void (*pPrint)(char *pString, uint32_t Value);
+} Case_t;
+
+static volatile uint32_t Sink;
+
+#ifdef HOST_PRINTF
+void _putchar(char Character)
+{
+}
+#endif
+
+static void FormatChannel(char *pString, uint32_t Value)
+{
+	UI_FormatNumber(pString, Value, 3, 0);
+}
+
+static void PrintChannel(char *pString, uint32_t Value)
+{
+	sprintf(pString, "%03d", (int)Value);
+}
+
+static void FormatFrequency(char *pString, uint32_t Value)
+{
+	UI_FormatFrequency(pString, Value);
+}
+
+static void PrintFrequency(char *pString, uint32_t Value)
+{
+	sprintf(pString, "%d.%05d", (int)(Value / 100000), (int)(Value % 100000));
+}
+
+static void FormatVoltage(char *pString, uint32_t Value)
+{
+	UI_FormatVoltage(pString, Value);
+}
+
+static void PrintVoltage(char *pString, uint32_t Value)
+{
+	sprintf(pString, "%d.%02dV", (int)(Value / 100), (int)(Value % 100));
+}
+
+static void FormatCTCSS(char *pString, uint32_t Value)
+{
+	UI_FormatCTCSS(pString, Value);
+}
+
+static void PrintCTCSS(char *pString, uint32_t Value)
+{
+	sprintf(pString, "%d.%dHz", (int)(Value / 10), (int)(Value % 10));
+}
+
+static void FormatDCS(char *pString, uint32_t Value)
+{
+	UI_FormatDCS(pString, Value, 'N');
+}
+
+static void PrintDCS(char *pString, uint32_t Value)
+{
+	sprintf(pString, "D%03o%c", (unsigned int)Value, 'N');
+}
+
+static const Case_t Cases[] = {
+	{ "channel", 1, 1, FormatChannel, PrintChannel },
+	{ "frequency", 1800000, 1250, FormatFrequency, PrintFrequency },
+	{ "voltage", 600, 1, FormatVoltage, PrintVoltage },
+	{ "ctcss", 670, 1, FormatCTCSS, PrintCTCSS },
+	{ "dcs", 0, 1, FormatDCS, PrintDCS },
+};
+
+static uint32_t GetValue(const Case_t *pCase, uint32_t i)
+{
+	uint32_t Value = pCase->First + ((i % BENCH_VALUES) * pCase->Step);
+
+	// DCS codes are 9 bits
+	if (pCase->pFormat == FormatDCS) {
+		Value &= 0x1FFU;
+	}
+
+	return Value;
+}
+
+static double TimeOnce(const Case_t *pCase, void (*pFunction)(char *, uint32_t))
+{
+	const uint64_t Start = HOST_GetNs();
+	uint64_t Elapsed;
+	uint32_t Calls = 0;
+	char String[32];
+
+	do {
+		uint32_t i;
+
+		for (i = 0; i < BENCH_VALUES; i++) {
+			pFunction(String, GetValue(pCase, i));
+			Sink += String[0];
+		}
+		Calls += BENCH_VALUES;
+		Elapsed = HOST_GetNs() - Start;
+	} while (Elapsed < BENCH_MIN_NS);
+
+	return (double)Elapsed / Calls;
+}
+
+// Best of a few runs, the host is not otherwise idle
+static double Time(const Case_t *pCase, void (*pFunction)(char *, uint32_t))
+{
+	double Best = TimeOnce(pCase, pFunction);
+	uint8_t i;
+
+	for (i = 1; i < BENCH_RUNS; i++) {
+		const double Run = TimeOnce(pCase, pFunction);
+
+		if (Run < Best) {
+			Best = Run;
+		}
+	}
+
+	return Best;
+}
+
+int main(void)
+{
+	int Failures = 0;
+	uint8_t i;
+
+	printf("%-10s %10s %10s %8s\n", "value", "ui ns", "sprintf ns", "ratio");
+
+	for (i = 0; i < sizeof(Cases) / sizeof(Cases[0]); i++) {
+		const Case_t *pCase = &Cases[i];
+		double Format;
+		double Print;
+		uint32_t j;
+
+		for (j = 0; j < BENCH_VALUES; j++) {
+			char Expected[32];
+			char String[32];
+
+			pCase->pPrint(Expected, GetValue(pCase, j));
+			pCase->pFormat(String, GetValue(pCase, j));
+			if (strcmp(String, Expected)) {
+				printf("FAIL %s %u: \"%s\", sprintf gives \"%s\"\n", pCase->pName, GetValue(pCase, j), String, Expected);
+				Failures++;
+				break;
+			}
+		}
+
+		Format = Time(pCase, pCase->pFormat);
+		Print = Time(pCase, pCase->pPrint);
+		printf("%-10s %10.1f %10.1f %8.2f\n", pCase->pName, Format, Print, Print / Format);
+	}
+
+	return Failures ? 1 : 0;
+}
+
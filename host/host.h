@@ -0,0 +1,36 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HOST_H
+#define HOST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Replies passed to UART_Send() since the last HOST_TxReset()
+extern uint8_t HOST_TxBuffer[4096];
+extern uint16_t HOST_TxLength;
+extern uint32_t HOST_BaudRate;
+
+void HOST_Receive(const void *pBuffer, uint16_t Size);
+void HOST_TxReset(void);
+uint64_t HOST_GetNs(void);
+
+uint16_t HOST_BuildFrame(uint8_t *pFrame, const void *pPayload, uint16_t Size, bool bEncrypted);
+int HOST_ParseReply(const uint8_t *pFrame, uint16_t Length, uint8_t *pPayload, bool bEncrypted);
+
+#endif
+
@@ -0,0 +1,217 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+#include <time.h>
+#include "bsp/dp32g030/crc.h"
+#include "bsp/dp32g030/dma.h"
+#include "bsp/dp32g030/gpio.h"
+#include "bsp/dp32g030/portcon.h"
+#include "driver/systick.h"
+#include "driver/uart.h"
+#include "host.h"
+
+uint32_t HOST_CrcCr;
+uint32_t HOST_CrcIv;
+volatile DMA_Channel_t HOST_DmaCh0;
+volatile GPIO_Bank_t HOST_GpioA;
+volatile GPIO_Bank_t HOST_GpioB;
+volatile GPIO_Bank_t HOST_GpioC;
+volatile uint32_t HOST_PortconPortaIe;
+volatile uint32_t HOST_PortconPortaOd;
+volatile uint32_t HOST_PortconPortcIe;
+
+uint8_t UART_DMA_Buffer[256];
+uint8_t HOST_TxBuffer[4096];
+uint16_t HOST_TxLength;
+uint32_t HOST_BaudRate = UART_BAUD_DEFAULT;
+
+static const uint8_t Obfuscation[16] = {
+	0x16, 0x6C, 0x14, 0xE6, 0x2E, 0x91, 0x0D, 0x40, 0x21, 0x35, 0xD5, 0x40, 0x13, 0x03, 0xE9, 0x80,
+};
+
+static uint16_t CrcTable[256];
+static volatile uint32_t CrcSlot;
+static bool bCrcPending;
+static bool bCrcRunning;
+static uint16_t Crc;
+
+// CRC-16/XMODEM, what the unit computes with the settings from CRC_Init()
+static uint16_t CrcByte(uint16_t Value, uint8_t Byte)
+{
+	if (!CrcTable[1]) {
+		uint16_t i;
+
+		for (i = 0; i < 256; i++) {
+			uint16_t Entry = i << 8;
+			uint8_t j;
+
+			for (j = 0; j < 8; j++) {
+				Entry = (Entry & 0x8000U) ? (Entry << 1) ^ 0x1021U : Entry << 1;
+			}
+			CrcTable[i] = Entry;
+		}
+	}
+
+	return (Value << 8) ^ CrcTable[((Value >> 8) ^ Byte) & 0xFFU];
+}
+
+static void CrcFlush(void)
+{
+	if (bCrcPending) {
+		if (!bCrcRunning) {
+			Crc = (uint16_t)HOST_CrcIv;
+			bCrcRunning = true;
+		}
+		Crc = CrcByte(Crc, (uint8_t)CrcSlot);
+		bCrcPending = false;
+	}
+}
+
+volatile uint32_t *HOST_CrcDataIn(void)
+{
+	CrcFlush();
+	bCrcPending = true;
+
+	return &CrcSlot;
+}
+
+uint32_t HOST_CrcDataOut(void)
+{
+	uint16_t Value;
+
+	CrcFlush();
+	Value = bCrcRunning ? Crc : (uint16_t)HOST_CrcIv;
+	bCrcRunning = false;
+
+	return Value;
+}
+
+static uint16_t CrcCalculate(const uint8_t *pData, uint16_t Size)
+{
+	uint16_t Value = 0;
+	uint16_t i;
+
+	for (i = 0; i < Size; i++) {
+		Value = CrcByte(Value, pData[i]);
+	}
+
+	return Value;
+}
+
+uint64_t HOST_GetNs(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return (uint64_t)Now.tv_sec * 1000000000U + Now.tv_nsec;
+}
+
+uint32_t SYSTICK_GetTimestamp(void)
+{
+	return (uint32_t)(HOST_GetNs() / 1000U);
+}
+
+// Stands in for the DMA channel filling the receive ring. The parser has to
+// keep up, nothing stops the ring from being overwritten.
+void HOST_Receive(const void *pBuffer, uint16_t Size)
+{
+	const uint8_t *pBytes = (const uint8_t *)pBuffer;
+	uint16_t Index = HOST_DmaCh0.ST & 0xFFFU;
+	uint16_t i;
+
+	for (i = 0; i < Size; i++) {
+		UART_DMA_Buffer[Index] = pBytes[i];
+		Index = (Index + 1) % sizeof(UART_DMA_Buffer);
+	}
+	HOST_DmaCh0.ST = Index;
+}
+
+void HOST_TxReset(void)
+{
+	HOST_TxLength = 0;
+}
+
+void UART_Send(const void *pBuffer, uint32_t Size)
+{
+	if (Size > sizeof(HOST_TxBuffer) - HOST_TxLength) {
+		Size = sizeof(HOST_TxBuffer) - HOST_TxLength;
+	}
+	memcpy(HOST_TxBuffer + HOST_TxLength, pBuffer, Size);
+	HOST_TxLength += Size;
+}
+
+void UART_SetBaudRate(uint32_t BaudRate)
+{
+	HOST_BaudRate = BaudRate;
+}
+
+bool UART_IsTxIdle(void)
+{
+	return true;
+}
+
+uint16_t UART_GetTxSpace(void)
+{
+	return sizeof(HOST_TxBuffer) - HOST_TxLength;
+}
+
+// Same framing as libuvk5.py: the CRC covers the plain payload and is
+// obfuscated along with it.
+uint16_t HOST_BuildFrame(uint8_t *pFrame, const void *pPayload, uint16_t Size, bool bEncrypted)
+{
+	const uint16_t CRC = CrcCalculate(pPayload, Size);
+	uint16_t i;
+
+	pFrame[0] = 0xAB;
+	pFrame[1] = 0xCD;
+	pFrame[2] = (Size >> 0) & 0xFFU;
+	pFrame[3] = (Size >> 8) & 0xFFU;
+	memcpy(pFrame + 4, pPayload, Size);
+	pFrame[4 + Size + 0] = (CRC >> 0) & 0xFFU;
+	pFrame[4 + Size + 1] = (CRC >> 8) & 0xFFU;
+	if (bEncrypted) {
+		for (i = 0; i < Size + 2; i++) {
+			pFrame[4 + i] ^= Obfuscation[i % 16];
+		}
+	}
+	pFrame[4 + Size + 2] = 0xDC;
+	pFrame[4 + Size + 3] = 0xBA;
+
+	return Size + 8;
+}
+
+// Returns the payload size of the reply at pFrame, or -1 if it is malformed
+int HOST_ParseReply(const uint8_t *pFrame, uint16_t Length, uint8_t *pPayload, bool bEncrypted)
+{
+	uint16_t Size;
+	uint16_t i;
+
+	if (Length < 8 || pFrame[0] != 0xAB || pFrame[1] != 0xCD) {
+		return -1;
+	}
+	Size = pFrame[2] | (pFrame[3] << 8);
+	if (Size + 8 > Length || pFrame[4 + Size + 2] != 0xDC || pFrame[4 + Size + 3] != 0xBA) {
+		return -1;
+	}
+	for (i = 0; i < Size; i++) {
+		pPayload[i] = pFrame[4 + i] ^ (bEncrypted ? Obfuscation[i % 16] : 0);
+	}
+
+	return Size;
+}
+
@@ -0,0 +1,41 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HOST_BSP_CRC_H
+#define HOST_BSP_CRC_H
+
+#include "../../../../bsp/dp32g030/crc.h"
+
+// The CRC unit is modelled in host/hw.c. A write to DATAIN is only folded in
+// on the next access, so the macros can stay plain lvalues.
+extern uint32_t HOST_CrcCr;
+extern uint32_t HOST_CrcIv;
+
+volatile uint32_t *HOST_CrcDataIn(void);
+uint32_t HOST_CrcDataOut(void);
+
+#undef CRC_CR
+#undef CRC_IV
+#undef CRC_DATAIN
+#undef CRC_DATAOUT
+
+#define CRC_CR		HOST_CrcCr
+#define CRC_IV		HOST_CrcIv
+#define CRC_DATAIN	(*HOST_CrcDataIn())
+#define CRC_DATAOUT	HOST_CrcDataOut()
+
+#endif
+
@@ -0,0 +1,30 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HOST_BSP_DMA_H
+#define HOST_BSP_DMA_H
+
+#include "../../../../bsp/dp32g030/dma.h"
+
+// ST of channel 0 is the receive ring write index, advanced by HOST_Receive()
+extern volatile DMA_Channel_t HOST_DmaCh0;
+
+#undef DMA_CH0
+
+#define DMA_CH0		(&HOST_DmaCh0)
+
+#endif
+
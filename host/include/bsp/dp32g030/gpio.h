@@ -0,0 +1,36 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HOST_BSP_GPIO_H
+#define HOST_BSP_GPIO_H
+
+#include "../../../../bsp/dp32g030/gpio.h"
+
+// The banks are plain memory in host/hw.c
+extern volatile GPIO_Bank_t HOST_GpioA;
+extern volatile GPIO_Bank_t HOST_GpioB;
+extern volatile GPIO_Bank_t HOST_GpioC;
+
+#undef GPIOA
+#undef GPIOB
+#undef GPIOC
+
+#define GPIOA		(&HOST_GpioA)
+#define GPIOB		(&HOST_GpioB)
+#define GPIOC		(&HOST_GpioC)
+
+#endif
+
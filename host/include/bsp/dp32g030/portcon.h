@@ -0,0 +1,36 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HOST_BSP_PORTCON_H
+#define HOST_BSP_PORTCON_H
+
+#include "../../../../bsp/dp32g030/portcon.h"
+
+// Only the registers the bus drivers switch at run time, in host/hw.c
+extern volatile uint32_t HOST_PortconPortaIe;
+extern volatile uint32_t HOST_PortconPortaOd;
+extern volatile uint32_t HOST_PortconPortcIe;
+
+#undef PORTCON_PORTA_IE
+#undef PORTCON_PORTA_OD
+#undef PORTCON_PORTC_IE
+
+#define PORTCON_PORTA_IE	HOST_PortconPortaIe
+#define PORTCON_PORTA_OD	HOST_PortconPortaOd
+#define PORTCON_PORTC_IE	HOST_PortconPortcIe
+
+#endif
+
@@ -0,0 +1,33 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#ifndef HOST_DRIVER_SYSTICK_H
+#define HOST_DRIVER_SYSTICK_H
+
+// The loop counts come from the firmware header. Its M0 loop is renamed out
+// of the way, on the host each delay is a call that delay_check counts.
+#define SYSTICK_DelayLoops	HOST_DelayLoops
+#define SYSTICK_DelayNs		HOST_DelayNs
+
+#include "../../../driver/systick.h"
+
+#undef SYSTICK_DelayLoops
+#undef SYSTICK_DelayNs
+
+void SYSTICK_DelayNs(uint32_t Delay);
+
+#endif
+
@@ -0,0 +1,143 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Radio side of everything app/uart.c links against. Enough state for the
+// commands to run, none of it does anything.
+
+#include <string.h>
+#include "app/activity.h"
+#include "app/app.h"
+#include "app/dtmf.h"
+#include "app/spectrum.h"
+#include "board.h"
+#include "driver/aes.h"
+#include "driver/bk4819.h"
+#include "driver/eeprom.h"
+#include "driver/gpio.h"
+#include "driver/st7565.h"
+#include "functions.h"
+#include "helper/battery.h"
+#include "helper/energy.h"
+#include "misc.h"
+#include "radio.h"
+#include "settings.h"
+#include "sram-overlay.h"
+#include "ui/ui.h"
+
+static VFO_Info_t Vfo;
+
+ACTIVITY_Bin_t gActivityBins[ACTIVITY_BINS];
+bool gActivityScanEnabled;
+uint8_t gBlittedLines;
+uint32_t gChallenge[4];
+FUNCTION_Type_t gCurrentFunction;
+uint32_t gCustomAesKey[4];
+const uint32_t gDefaultAesKey[4];
+EEPROM_Config_t gEeprom;
+ENERGY_Stats_t gEnergy;
+uint8_t gFrameBuffer[7][128];
+uint8_t gIsLocked;
+VFO_Info_t *gRxVfo = &Vfo;
+GUI_DisplayType_t gScreenToDisplay;
+uint32_t gSpectrumCenter;
+uint8_t gSpectrumRSSI[SPECTRUM_POINTS];
+uint16_t gSpectrumRate;
+uint16_t gSpectrumSettleUs;
+uint16_t gSpectrumStep;
+uint16_t gSpectrumSweepCount;
+uint8_t gSpectrumWaterfallCount;
+uint8_t gStatusLine[128];
+uint8_t gTryCount;
+bool bHasCustomAesKey;
+bool bIsInLockScreen;
+bool g_SquelchLost;
+uint16_t gRadioInterruptMask;
+uint32_t gRadioInterruptTimestamp;
+uint32_t gRadioPollLateMaxUs;
+
+// Room past the end for a page written at the last address
+static uint8_t Eeprom[0x2000 + 0x100];
+
+void ACTIVITY_Clear(void)
+{
+}
+
+void ACTIVITY_Seed(uint32_t Frequency, uint8_t Score)
+{
+}
+
+void AES_Encrypt(const void *pKey, const void *pIv, const void *pIn, void *pOut, uint8_t NumBlocks)
+{
+}
+
+uint16_t BATTERY_GetSaveTime(void)
+{
+	return 0;
+}
+
+uint16_t BK4819_GetRegister(BK4819_REGISTER_t Register)
+{
+	return 0;
+}
+
+void BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage, uint16_t *pCurrent)
+{
+	*pVoltage = 0;
+	*pCurrent = 0;
+}
+
+void BOARD_EEPROM_Init(void)
+{
+}
+
+void DTMF_InvalidateContact(uint8_t Index)
+{
+}
+
+bool EEPROM_IsReady(void)
+{
+	return true;
+}
+
+void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+{
+	memcpy(pBuffer, Eeprom + (Address & 0x1FFFU), Size);
+}
+
+void EEPROM_WritePage(uint16_t Address, const void *pBuffer, uint8_t Size)
+{
+	memcpy(Eeprom + (Address & 0x1FFFU), pBuffer, Size);
+}
+
+void FUNCTION_Select(FUNCTION_Type_t Function)
+{
+	gCurrentFunction = Function;
+}
+
+void GPIO_ClearBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+}
+
+const uint8_t *SPECTRUM_GetWaterfallRow(uint8_t Age)
+{
+	return NULL;
+}
+
+bool overlay_FLASH_RebootToBootloader(void)
+{
+	return false;
+}
+
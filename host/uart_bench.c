@@ -0,0 +1,169 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Throughput of the frame parser in app/uart.c. The traffic is fed through
+// the receive ring Chunk bytes at a time, as if the main loop polled every
+// Chunk characters, and every frame found is counted but not handled.
+// Without arguments a session of EEPROM reads and writes is synthesized,
+// otherwise the file is replayed as the raw bytes a host sent to the radio.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "app/uart.h"
+#include "host.h"
+
+#define BENCH_MIN_NS	200000000U
+
+// A whole ring of unread bytes would look empty, so 255 is the limit
+static const uint16_t Chunks[] = { 1, 4, 16, 64, 255 };
+
+static uint8_t *pTraffic;
+static uint32_t TrafficSize;
+static uint32_t TrafficFrames;
+
+static void AddFrame(const uint8_t *pPayload, uint16_t Size)
+{
+	pTraffic = realloc(pTraffic, TrafficSize + Size + 8);
+	if (!pTraffic) {
+		exit(1);
+	}
+	TrafficSize += HOST_BuildFrame(pTraffic + TrafficSize, pPayload, Size, true);
+	TrafficFrames++;
+}
+
+static void Synthesize(void)
+{
+	uint8_t Payload[12 + 0x80];
+	uint16_t Offset;
+
+	memset(Payload, 0, sizeof(Payload));
+	Payload[0] = 0x14;
+	Payload[1] = 0x05;
+	Payload[2] = 4;
+	AddFrame(Payload, 8);
+
+	// Read the whole EEPROM a block at a time, then write it back
+	for (Offset = 0; Offset < 0x2000; Offset += 0x80) {
+		Payload[0] = 0x1B;
+		Payload[1] = 0x05;
+		Payload[2] = 8;
+		Payload[4] = (Offset >> 0) & 0xFFU;
+		Payload[5] = (Offset >> 8) & 0xFFU;
+		Payload[6] = 0x80;
+		AddFrame(Payload, 12);
+	}
+	for (Offset = 0; Offset < 0x2000; Offset += 0x80) {
+		uint16_t i;
+
+		Payload[0] = 0x1D;
+		Payload[1] = 0x05;
+		Payload[2] = 8 + 0x80;
+		Payload[4] = (Offset >> 0) & 0xFFU;
+		Payload[5] = (Offset >> 8) & 0xFFU;
+		Payload[6] = 0x80;
+		for (i = 0; i < 0x80; i++) {
+			Payload[12 + i] = rand();
+		}
+		AddFrame(Payload, 12 + 0x80);
+	}
+}
+
+static bool Load(const char *pPath)
+{
+	FILE *fp = fopen(pPath, "rb");
+	long Size;
+
+	if (!fp) {
+		return false;
+	}
+	fseek(fp, 0, SEEK_END);
+	Size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	pTraffic = malloc(Size ? Size : 1);
+	TrafficSize = fread(pTraffic, 1, Size, fp);
+	fclose(fp);
+
+	return TrafficSize == (uint32_t)Size;
+}
+
+static uint32_t Replay(uint16_t Chunk)
+{
+	uint32_t Frames = 0;
+	uint32_t i;
+
+	for (i = 0; i < TrafficSize; i += Chunk) {
+		const uint32_t Length = TrafficSize - i < Chunk ? TrafficSize - i : Chunk;
+
+		HOST_Receive(pTraffic + i, Length);
+		while (UART_IsCommandAvailable()) {
+			Frames++;
+		}
+	}
+
+	return Frames;
+}
+
+int main(int argc, char *argv[])
+{
+	uint8_t i;
+
+	if (argc > 2) {
+		fprintf(stderr, "Usage: %s [capture.bin]\n", argv[0]);
+		return 1;
+	}
+	if (argc == 2) {
+		if (!Load(argv[1])) {
+			fprintf(stderr, "Cannot read %s\n", argv[1]);
+			return 1;
+		}
+	} else {
+		Synthesize();
+	}
+
+	printf("%u bytes per pass\n", TrafficSize);
+	printf("chunk      MB/s   frames/s    ns/byte\n");
+
+	for (i = 0; i < sizeof(Chunks) / sizeof(Chunks[0]); i++) {
+		const uint64_t Start = HOST_GetNs();
+		uint64_t Elapsed;
+		uint32_t Passes = 0;
+		uint32_t Frames = 0;
+		double Seconds;
+
+		do {
+			const uint32_t Found = Replay(Chunks[i]);
+
+			if (argc == 1 && Found != TrafficFrames) {
+				fprintf(stderr, "Chunk %u: %u of %u frames parsed\n", Chunks[i], Found, TrafficFrames);
+				return 1;
+			}
+			Frames += Found;
+			Passes++;
+			Elapsed = HOST_GetNs() - Start;
+		} while (Elapsed < BENCH_MIN_NS);
+
+		Seconds = Elapsed / 1e9;
+		printf("%5u %9.2f %10.0f %10.2f\n",
+			Chunks[i],
+			(double)TrafficSize * Passes / Seconds / 1e6,
+			Frames / Seconds,
+			(double)Elapsed / ((double)TrafficSize * Passes));
+	}
+
+	return 0;
+}
+
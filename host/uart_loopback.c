@@ -0,0 +1,313 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Feeds frames through the receive ring into app/uart.c and checks what
+// comes back: the version handshake, rejected and cut short frames, an
+// EEPROM write read back, the baud rate negotiation of CMD 0x0537 with its
+// timeouts, the columns the screen mirror sends for a change and the energy
+// counters.
+// Frames go in 7 bytes at a time, so they keep straddling the ring wrap.
+
+#include <stdio.h>
+#include <string.h>
+#include "app/uart.h"
+#include "driver/st7565.h"
+#include "driver/uart.h"
+#include "helper/energy.h"
+#include "host.h"
+#include "version.h"
+
+// Ticks of 10ms, from app/uart.c
+#define BAUD_CONFIRM_TIMEOUT	200U
+#define BAUD_IDLE_TIMEOUT	3000U
+#define UART_FRAME_TIMEOUT	10U
+
+#define RX_CHUNK		7U
+
+#define CHECK(x) \
+	do { \
+		if (!(x)) { \
+			printf("FAIL line %d: %s\n", __LINE__, #x); \
+			Failures++; \
+		} \
+	} while (0)
+
+static const uint32_t Session = 0x6B5A4F3EU;
+
+static uint8_t Reply[256];
+static int Failures;
+
+static uint16_t Get16(const uint8_t *pData)
+{
+	return pData[0] | (pData[1] << 8);
+}
+
+static uint32_t Get32(const uint8_t *pData)
+{
+	return Get16(pData) | ((uint32_t)Get16(pData + 2) << 16);
+}
+
+static void Put16(uint8_t *pData, uint16_t Value)
+{
+	pData[0] = (Value >> 0) & 0xFFU;
+	pData[1] = (Value >> 8) & 0xFFU;
+}
+
+static void Put32(uint8_t *pData, uint32_t Value)
+{
+	Put16(pData + 0, (Value >> 0) & 0xFFFFU);
+	Put16(pData + 2, (Value >> 16) & 0xFFFFU);
+}
+
+static void Receive(const uint8_t *pFrame, uint16_t Length)
+{
+	uint16_t i;
+
+	for (i = 0; i < Length; i += RX_CHUNK) {
+		HOST_Receive(pFrame + i, Length - i < RX_CHUNK ? Length - i : RX_CHUNK);
+		while (UART_IsCommandAvailable()) {
+			UART_HandleCommand();
+		}
+	}
+}
+
+static void Tick(uint16_t Count)
+{
+	while (Count--) {
+		UART_TimeSlice10ms();
+	}
+}
+
+// Returns the size of the reply payload, -1 if nothing was sent back
+static int Collect(void)
+{
+	const int Size = HOST_ParseReply(HOST_TxBuffer, HOST_TxLength, Reply, true);
+
+	if (HOST_TxLength && Size < 0) {
+		printf("Malformed reply of %u bytes\n", HOST_TxLength);
+		Failures++;
+	}
+	HOST_TxReset();
+
+	return Size;
+}
+
+static int Exchange(uint16_t ID, const uint8_t *pBody, uint16_t Size)
+{
+	uint8_t Payload[252];
+	uint8_t Frame[260];
+
+	Put16(Payload + 0, ID);
+	Put16(Payload + 2, Size);
+	memcpy(Payload + 4, pBody, Size);
+	Receive(Frame, HOST_BuildFrame(Frame, Payload, Size + 4, true));
+
+	return Collect();
+}
+
+static int SetBaudRate(uint32_t BaudRate, uint32_t Timestamp)
+{
+	uint8_t Body[8];
+
+	Put32(Body + 0, BaudRate);
+	Put32(Body + 4, Timestamp);
+
+	return Exchange(0x0537, Body, sizeof(Body));
+}
+
+static int ReadEeprom(uint16_t Offset, uint8_t Size)
+{
+	uint8_t Body[8];
+
+	memset(Body, 0, sizeof(Body));
+	Put16(Body + 0, Offset);
+	Body[2] = Size;
+	Put32(Body + 4, Session);
+
+	return Exchange(0x051B, Body, sizeof(Body));
+}
+
+static void TestHello(void)
+{
+	uint8_t Body[4];
+
+	Put32(Body, Session);
+	CHECK(Exchange(0x0514, Body, sizeof(Body)) == 4 + 36);
+	CHECK(Get16(Reply) == 0x0515);
+	CHECK(strcmp((const char *)Reply + 4, Version) == 0);
+}
+
+static void TestRejected(void)
+{
+	uint8_t Payload[8];
+	uint8_t Frame[16];
+	uint16_t Length;
+
+	// Corrupted on the way in
+	Put16(Payload + 0, 0x0514);
+	Put16(Payload + 2, 4);
+	Put32(Payload + 4, Session);
+	Length = HOST_BuildFrame(Frame, Payload, sizeof(Payload), true);
+	Frame[6] ^= 0x01;
+	Receive(Frame, Length);
+	CHECK(Collect() < 0);
+
+	// Cut short, it is dropped and the next frame gets through
+	Length = HOST_BuildFrame(Frame, Payload, sizeof(Payload), true);
+	Receive(Frame, Length - 3);
+	CHECK(!UART_IsRxIdle());
+	Tick(UART_FRAME_TIMEOUT);
+	CHECK(UART_IsRxIdle());
+	CHECK(Collect() < 0);
+	TestHello();
+
+	// Belongs to another session
+	CHECK(SetBaudRate(115200U, Session + 1) < 0);
+
+	// Not a rate the radio offers
+	CHECK(SetBaudRate(12345U, Session) == 8);
+	CHECK(Get16(Reply) == 0x0538 && Get32(Reply + 4) == 0);
+	Tick(1);
+	CHECK(HOST_BaudRate == UART_BAUD_DEFAULT);
+}
+
+static void TestEeprom(void)
+{
+	uint8_t Body[8 + 32];
+	uint16_t i;
+
+	memset(Body, 0, sizeof(Body));
+	Put16(Body + 0, 0x0100);
+	Body[2] = 32;
+	Put32(Body + 4, Session);
+	for (i = 0; i < 32; i++) {
+		Body[8 + i] = 0xA0 + i;
+	}
+	// The reply only comes once the page has been written
+	CHECK(Exchange(0x051D, Body, sizeof(Body)) < 0);
+	for (i = 0; i < 10 && !HOST_TxLength; i++) {
+		Tick(1);
+	}
+	CHECK(Collect() == 6 && Get16(Reply) == 0x051E && Get16(Reply + 4) == 0x0100);
+
+	CHECK(ReadEeprom(0x0100, 32) == 8 + 32);
+	CHECK(Get16(Reply) == 0x051C && Get16(Reply + 4) == 0x0100 && Reply[6] == 32);
+	CHECK(memcmp(Reply + 8, Body + 8, 32) == 0);
+}
+
+static void TestBaudRate(void)
+{
+	// The acknowledgement has to go out at the old rate
+	CHECK(SetBaudRate(115200U, Session) == 8);
+	CHECK(Get16(Reply) == 0x0538 && Get32(Reply + 4) == 115200U);
+	CHECK(HOST_BaudRate == UART_BAUD_DEFAULT);
+	Tick(1);
+	CHECK(HOST_BaudRate == 115200U);
+
+	// Nothing heard at the new rate, so the radio falls back
+	Tick(BAUD_CONFIRM_TIMEOUT - 1);
+	CHECK(HOST_BaudRate == 115200U);
+	Tick(1);
+	CHECK(HOST_BaudRate == UART_BAUD_DEFAULT);
+
+	// Confirmed by a frame at the new rate, kept until the link goes idle
+	CHECK(SetBaudRate(230400U, Session) == 8);
+	Tick(1);
+	CHECK(HOST_BaudRate == 230400U);
+	Tick(BAUD_CONFIRM_TIMEOUT / 2);
+	CHECK(ReadEeprom(0x0100, 8) == 8 + 8);
+	Tick(BAUD_CONFIRM_TIMEOUT);
+	CHECK(HOST_BaudRate == 230400U);
+	Tick(BAUD_IDLE_TIMEOUT - BAUD_CONFIRM_TIMEOUT - 1);
+	CHECK(HOST_BaudRate == 230400U);
+	Tick(1);
+	CHECK(HOST_BaudRate == UART_BAUD_DEFAULT);
+
+	// Back at the default rate the link still works
+	CHECK(ReadEeprom(0x0100, 8) == 8 + 8);
+}
+
+static void TestMirror(void)
+{
+	uint8_t Body[8];
+	uint16_t Offset;
+	uint8_t Lines;
+
+	memset(Body, 0, sizeof(Body));
+	Body[0] = true;
+	Put32(Body + 4, Session);
+	CHECK(Exchange(0x053F, Body, sizeof(Body)) < 0);
+
+	// Every line in full once
+	Tick(1);
+	Lines = 0;
+	for (Offset = 0; Offset + 8 <= HOST_TxLength; Offset += 8 + Get16(HOST_TxBuffer + Offset + 2)) {
+		CHECK(HOST_ParseReply(HOST_TxBuffer + Offset, HOST_TxLength - Offset, Reply, true) >= 12);
+		CHECK(Get16(Reply) == 0x0540 && Reply[7] == 0 && Reply[8] == 128);
+		Lines |= 1U << Reply[6];
+	}
+	CHECK(Lines == 0xFF);
+	HOST_TxReset();
+
+	// A blit with nothing changed sends nothing
+	gBlittedLines |= 0x08U;
+	Tick(1);
+	CHECK(Collect() < 0);
+
+	// Only the changed columns
+	gFrameBuffer[2][40] = 0x5A;
+	gFrameBuffer[2][42] = 0xA5;
+	gBlittedLines |= 0x08U;
+	Tick(1);
+	CHECK(Collect() >= 12);
+	CHECK(Reply[6] == 3 && Reply[7] == 40 && Reply[8] == 3);
+
+	Body[0] = false;
+	CHECK(Exchange(0x053F, Body, sizeof(Body)) < 0);
+	Tick(1);
+	HOST_TxReset();
+}
+
+static void TestEnergy(void)
+{
+	uint8_t Body[4];
+
+	gEnergy.Ticks = 123456;
+	gEnergy.BusyUs = 0xFEDCBA98U;
+	Put32(Body, Session);
+	CHECK(Exchange(0x0547, Body, sizeof(Body)) == 4 + 64);
+	CHECK(Get16(Reply) == 0x0548);
+	CHECK(Get32(Reply + 4) == 123456 && Get32(Reply + 4 + 14 * 4) == 0xFEDCBA98U);
+}
+
+int main(void)
+{
+	TestHello();
+	TestRejected();
+	TestEeprom();
+	TestBaudRate();
+	TestMirror();
+	TestEnergy();
+
+	if (Failures) {
+		printf("%d checks failed\n", Failures);
+		return 1;
+	}
+	printf("All checks passed\n");
+
+	return 0;
+}
+
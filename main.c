@@ -29,6 +29,7 @@
 #include "driver/uart.h"
 #include "helper/battery.h"
 #include "helper/boot.h"
+#include "helper/energy.h"
 #include "misc.h"
 #include "radio.h"
 #include "settings.h"
@@ -44,8 +45,6 @@ void _putchar(char c)
 
 void Main(void)
 {
-	uint8_t i;
-
 	// Enable clock gating of blocks we need.
 	SYSCON_DEV_CLK_GATE = 0
 		| SYSCON_DEV_CLK_GATE_GPIOA_BITS_ENABLE
@@ -74,16 +73,15 @@ void Main(void)
 	BOARD_ADC_GetBatteryInfo(&gBatteryCurrentVoltage, &gBatteryCurrent);
 	BOARD_EEPROM_Init();
 	BOARD_EEPROM_LoadMoreSettings();
+	DTMF_SetupMatcher();
+	DTMF_LoadContacts();
 
 	RADIO_ConfigureChannel(0, 2);
 	RADIO_ConfigureChannel(1, 2);
 	RADIO_SelectVfos();
 	RADIO_SetupRegisters(true);
 
-	for (i = 0; i < 4; i++) {
-		BOARD_ADC_GetBatteryInfo(&gBatteryVoltages[i], &gBatteryCurrent);
-	}
-
+	BATTERY_Prime();
 	BATTERY_GetReadings(false);
 	if (!gChargingWithTypeC && !gBatteryDisplayLevel) {
 		FUNCTION_Select(FUNCTION_POWER_SAVE);
@@ -108,6 +106,8 @@ void Main(void)
 	}
 
 	while (1) {
+		const uint32_t Start = SYSTICK_GetTimestamp();
+
 		APP_Update();
 		if (gNextTimeslice) {
 			APP_TimeSlice10ms();
@@ -117,6 +117,7 @@ void Main(void)
 			APP_TimeSlice500ms();
 			gNextTimeslice500ms = false;
 		}
+		ENERGY_AddBusy(Start);
 	}
 }
 
@@ -66,7 +66,6 @@ uint8_t gFoundCDCSS;
 bool gEndOfRxDetectedMaybe;
 uint8_t gVFO_RSSI_Level[2];
 uint8_t gReducedService;
-uint8_t gBatteryVoltageIndex;
 CssScanMode_t gCssScanMode;
 bool gUpdateRSSI;
 AlarmState_t gAlarmState;
@@ -121,6 +120,7 @@ uint8_t gFSKWriteIndex;
 uint8_t gNeverUsed;
 
 volatile bool gNextTimeslice;
+volatile uint32_t gGlobalSysTickCounter;
 bool gUpdateDisplay;
 bool gF_LOCK;
 uint8_t gShowChPrefix;
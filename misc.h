@@ -115,7 +115,6 @@ extern uint8_t gFoundCDCSS;
 extern bool gEndOfRxDetectedMaybe;
 extern uint8_t gVFO_RSSI_Level[2];
 extern uint8_t gReducedService;
-extern uint8_t gBatteryVoltageIndex;
 extern CssScanMode_t gCssScanMode;
 extern bool gUpdateRSSI;
 extern AlarmState_t gAlarmState;
@@ -170,6 +169,7 @@ extern uint8_t gFSKWriteIndex;
 extern uint8_t gNeverUsed;
 
 extern volatile bool gNextTimeslice;
+extern volatile uint32_t gGlobalSysTickCounter;
 extern bool gUpdateDisplay;
 extern uint8_t gFM_ChannelPosition;
 extern bool gF_LOCK;
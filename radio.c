@@ -328,11 +328,24 @@ void RADIO_ConfigureChannel(uint8_t VFO, uint32_t Arg) {
     RADIO_ApplyOffset(pRadio);
     memset(gEeprom.VfoInfo[VFO].Name, 0, sizeof(gEeprom.VfoInfo[VFO].Name));
     if (IS_MR_CHANNEL(Channel)) {
+        char *pName = gEeprom.VfoInfo[VFO].Name;
+        uint8_t i;
+
         // 16 bytes allocated but only 12 used
         EEPROM_ReadBuffer(0x0F50 + (Channel * 0x10),
                           gEeprom.VfoInfo[VFO].Name + 0, 8);
         EEPROM_ReadBuffer(0x0F58 + (Channel * 0x10),
                           gEeprom.VfoInfo[VFO].Name + 8, 2);
+        // Erased EEPROM pads a name with 0xFF, which is Win1251 'ya'. Without
+        // a NUL in the 10 bytes the trailing 0xFF are padding, a NUL
+        // terminated name can still end in 'ya'.
+        for (i = 0; i < 10 && pName[i] != 0; i++) {
+        }
+        if (i == 10) {
+            while (i > 0 && pName[i - 1] == (char)0xFF) {
+                pName[--i] = 0;
+            }
+        }
     }
 
     if (!gEeprom.VfoInfo[VFO].FrequencyReverse) {
@@ -31,8 +31,6 @@
 		} \
 	} while(0)
 
-static volatile uint32_t gGlobalSysTickCounter;
-
 void SystickHandler(void);
 
 void SystickHandler(void)
@@ -0,0 +1,82 @@
+import libuvk5
+import sys
+import os
+import time
+
+
+# Replays a canned day on the radio and reports the estimated mAh, so power
+# save changes can be compared by running it before and after flashing.
+# Standby and scan are measured on the radio for a few minutes each and
+# scaled to their share of the day. RX bursts and TX need a signal or the
+# transmitter, so those are built from the same counters and only modelled.
+
+if len(sys.argv) not in [2,3]: print(f'Usage: {os.path.basename(sys.argv[0])} <COMx> [seconds_per_phase]') ; exit(1)
+
+arg_port = sys.argv[1]
+arg_seconds = int(sys.argv[2]) if len(sys.argv)==3 else 120
+
+KEY_EXIT = 13
+KEY_STAR = 14
+
+BATTERY_MAH = 1600
+
+# name, hours per day, keys to enter the phase, keys to leave it
+DAY = [
+    ('standby', 20.0, [], []),
+    ('scan',     2.0, [(KEY_STAR,True,False,0), (KEY_STAR,True,True,600), (KEY_STAR,False,True,100)],
+                      [(KEY_EXIT,True,False,0), (KEY_EXIT,False,False,100)]),
+]
+
+# name, hours per day, burst seconds, seconds of foreground with the
+# backlight on after each burst, TX power level or None for RX
+BURSTS = [
+    ('rx bursts', 1.5, 20, 10, None),
+    ('tx',        0.5, 15, 10, 2),
+]
+
+
+def inject(radio, keys):
+    if keys:
+        radio.inject_keys(keys)
+        time.sleep(sum(k[3] for k in keys) / 1000 + 1)
+        radio.serial.reset_input_buffer()
+
+
+def measure(radio, keys_in, keys_out, seconds):
+    inject(radio, keys_in)
+    before = radio.get_energy_stats()
+    time.sleep(seconds)
+    after = radio.get_energy_stats()
+    inject(radio, keys_out)
+    return libuvk5.energy_delta(after, before)
+
+
+def burst(seconds, tail, level):
+    ticks = (seconds + tail) * 100
+    stats = {'ticks':ticks, 'function':[tail * 100, 0, 0, 0, 0, 0], 'rx_idle':0, 'radio_sleep':0,
+             'backlight':ticks, 'tx_power':[0, 0, 0], 'clock_slow':0, 'busy_us':0}
+    if level is None:
+        stats['function'][libuvk5.FUNCTION_RECEIVE] = seconds * 100
+    else:
+        stats['function'][libuvk5.FUNCTION_TRANSMIT] = seconds * 100
+        stats['tx_power'][level] = seconds * 100
+    return stats
+
+
+with libuvk5.uvk5(arg_port) as radio:
+    if radio.connect():
+        _=radio.get_fw_version()
+        phases = []
+        for name,hours,keys_in,keys_out in DAY:
+            print(f'Measuring {name} for {arg_seconds}s...')
+            phases.append((name, hours, measure(radio, keys_in, keys_out, arg_seconds)))
+        for name,hours,seconds,tail,level in BURSTS:
+            phases.append((name, hours, burst(seconds, tail, level)))
+
+        total = 0.0
+        for name,hours,stats in phases:
+            ma = libuvk5.estimate_energy_current(stats)
+            busy = stats['busy_us'] / (stats['ticks'] * 100) if stats['ticks'] else 0
+            total += ma * hours
+            print(f'{name:10s} {hours:5.1f}h {ma:7.1f}mA {ma * hours:7.1f}mAh  cpu busy {busy:5.1f}% polling {100 - busy:5.1f}%')
+        print(f'Total {total:.1f}mAh per day, {BATTERY_MAH / total:.1f} days on {BATTERY_MAH}mAh')
@@ -1,6 +1,7 @@
 import serial
 import struct
 import os
+import time
 
 
 Crc16Tab = [0, 4129, 8258, 12387, 16516, 20645, 24774, 28903, 33032, 37161, 41290, 45419, 49548, 53677, 57806, 61935, 4657, 528, 12915, 8786, 21173, 17044, 29431, 25302,
@@ -29,6 +30,72 @@ def crc16_ccitt_le(data):
     return bytes([crc & 0xFF,]) + bytes([crc>>8,])
 
 
+def rle_decode(data):
+    out = b''
+    i = 0
+    while i < len(data):
+        control = data[i]
+        if control & 0x80:
+            out += bytes([data[i+1]]) * ((control & 0x7F) + 1)
+            i += 2
+        else:
+            out += data[i+1:i+2+control]
+            i += 2 + control
+    return out
+
+# Rough supply current in mA per FUNCTION_Type_t, backlight off. Power save
+# sleeps for save_time ticks and then listens for 10 ticks.
+FUNCTION_CURRENT_MA = [60, 1200, 65, 65, 110, None]
+POWER_SAVE_SLEEP_MA = 15
+POWER_SAVE_WAKE_MA  = 60
+POWER_SAVE_WAKE     = 10
+
+def estimate_current(ticks, save_time):
+    # ticks: 10ms ticks spent per function, returns the average mA
+    total = sum(ticks)
+    if total == 0:
+        return 0.0
+    save = (POWER_SAVE_SLEEP_MA * save_time + POWER_SAVE_WAKE_MA * POWER_SAVE_WAKE) / (save_time + POWER_SAVE_WAKE)
+    charge = 0.0
+    for function,count in enumerate(ticks):
+        charge += count * (FUNCTION_CURRENT_MA[function] if FUNCTION_CURRENT_MA[function] is not None else save)
+    return charge / total
+
+# Rough supply current in mA of each part of the radio. Counters from the
+# energy stats are in 10ms ticks, see ENERGY_Stats_t in helper/energy.h.
+FUNCTION_TRANSMIT  = 1
+FUNCTION_RECEIVE   = 4
+CPU_MA             = 8
+CPU_SLOW_MA        = 3
+RADIO_RX_MA        = 20
+RADIO_SLEEP_MA     = 1
+BACKLIGHT_MA       = 20
+AUDIO_MA           = 80
+TX_MA              = [500, 800, 1300]
+
+def estimate_energy_current(stats):
+    # Returns the average mA over the ticks in stats
+    ticks = stats['ticks']
+    if ticks == 0:
+        return 0.0
+    tx = sum(stats['tx_power'])
+    charge  = ticks * CPU_MA + stats['clock_slow'] * (CPU_SLOW_MA - CPU_MA)
+    charge += (ticks - stats['radio_sleep'] - tx) * RADIO_RX_MA + stats['radio_sleep'] * RADIO_SLEEP_MA
+    charge += stats['backlight'] * BACKLIGHT_MA + stats['function'][FUNCTION_RECEIVE] * AUDIO_MA
+    for level,count in enumerate(stats['tx_power']):
+        charge += count * TX_MA[level]
+    return charge / ticks
+
+def energy_delta(after, before):
+    # Counters accumulated between two get_energy_stats() calls. They are
+    # uint32 on the radio, busy_us wraps after ~71 minutes.
+    delta = {}
+    for key in ['ticks','rx_idle','radio_sleep','backlight','clock_slow','busy_us']:
+        delta[key] = (after[key] - before[key]) % 2**32
+    for key in ['function','tx_power']:
+        delta[key] = [(a - b) % 2**32 for a,b in zip(after[key], before[key])]
+    return delta
+
 def firmware_xor(fwcontent):
     XOR_ARRAY = bytes.fromhex('4722c0525d574894b16060db6fe34c7cd84ad68b30ec25e04cd9007fbfe35405e93a976bb06e0cfbb11ae2c9c15647e9baf142b6675f0f96f7c93c841b26e14e3b6f66e6a06ab0bfc6a5703aba189e271a535b71b1941e18f2d6810222fd5a2891dbba5d64c6fe86839c501c730311d6af30f42c77b27dbb3f29285722d6928b')
     XOR_LEN   = len(XOR_ARRAY)
@@ -82,6 +149,17 @@ class uvk5:
         self.CMD_0530         = b'\x30\x05' #0x0530 -> no reply //Only in bootloader
         self.CMD_0527         = b'\x27\x05'
         self.CMD_0529         = b'\x29\x05'
+        self.CMD_SPECTRUM     = b'\x31\x05' #0x0531 -> 0x0532
+        self.CMD_WATERFALL    = b'\x33\x05' #0x0533 -> 0x0534
+        self.CMD_ACTIVITY     = b'\x35\x05' #0x0535 -> 0x0536
+        self.CMD_BAUDRATE     = b'\x37\x05' #0x0537 -> 0x0538
+        self.CMD_EEPROM_READ  = b'\x39\x05' #0x0539 -> 0x053A...
+        self.CMD_EEPROM_WRITE = b'\x3B\x05' #0x053B -> 0x053C
+        self.CMD_TELEMETRY    = b'\x3D\x05' #0x053D -> 0x053E...
+        self.CMD_SCREEN       = b'\x3F\x05' #0x053F -> 0x0540...
+        self.CMD_KEYS         = b'\x41\x05' #0x0541 -> 0x0542...
+        self.CMD_POWER        = b'\x43\x05' #0x0543 -> 0x0544
+        self.CMD_ENERGY       = b'\x47\x05' #0x0547 -> 0x0548
         
         self.debug = False if os.getenv('DEBUG') is None else True
 
@@ -231,4 +309,187 @@ class uvk5:
         self.uart_send_msg(cmd)
         reply = self.uart_receive_msg(16)
         reply = struct.unpack('<HH',reply[8:-4])
-        return reply
\ No newline at end of file
+        return reply
+
+    def get_spectrum(self):
+        cmd = self.CMD_SPECTRUM + struct.pack('<H',4) + self.sessTimestamp
+        cmd_crc = struct.pack('<H',crc16_ccitt(cmd))
+        cmd = b'\xAB\xCD' + struct.pack('<H',8) + cmd + cmd_crc + b'\xDC\xBA'
+        self.uart_send_msg(cmd)
+        reply = self.uart_receive_msg(152)
+        center,step,settle,rate,sweeps = struct.unpack('<IHHHH',reply[8:20])
+        rssi = [x - 160 for x in reply[20:148]]
+        return {'center':center*10, 'step':step*10, 'settle_us':settle, 'points_per_second':rate, 'sweeps':sweeps, 'rssi':rssi}
+
+    def get_waterfall(self):
+        rows = []
+        while True:
+            cmd = self.build_uart_command(self.CMD_WATERFALL, struct.pack('<BBH',len(rows),4,0) + self.sessTimestamp)
+            self.uart_send_msg(cmd)
+            head = self.serial.read(4)
+            size = struct.unpack('<H',head[2:4])[0]
+            msg_raw = head + self.serial.read(size + 4)
+            reply = msg_raw[:4] + payload_xor(msg_raw[4:-2]) + msg_raw[-2:]
+            age,count,total = struct.unpack('<BBB',reply[8:11])
+            for i in range(count):
+                row = reply[12+i*32:12+(i+1)*32]
+                rows.append([(row[x//4] >> ((x%4)*2)) & 3 for x in range(128)])
+            if count == 0 or len(rows) >= total:
+                return rows
+
+    def activity(self,action=0,entries=[]):
+        # action: 0 - read, 1 - clear, 2 - seed with [(frequency_hz, score), ...]
+        body = struct.pack('<BBH',action,len(entries),0) + self.sessTimestamp
+        for freq,score in entries:
+            body += struct.pack('<IB3x',freq//10,score)
+        cmd = self.build_uart_command(self.CMD_ACTIVITY, body)
+        self.uart_send_msg(cmd)
+        reply = self.uart_receive_msg(8 + 4 + 16*8 + 4)
+        enabled = reply[8] != 0
+        bins = []
+        for i in range(16):
+            freq,score = struct.unpack('<IB3x',reply[12+i*8:20+i*8])
+            if score:
+                bins.append((freq*10,score))
+        return {'scan_enabled':enabled, 'bins':sorted(bins, key=lambda x: -x[1])}
+
+    def set_baudrate(self,baudrate):
+        # The radio switches after its reply and falls back to 38400 unless a
+        # valid frame arrives within 2s, then after 30s without any traffic.
+        cmd = self.build_uart_command(self.CMD_BAUDRATE, struct.pack('<I',baudrate) + self.sessTimestamp)
+        self.uart_send_msg(cmd)
+        reply = self.uart_receive_msg(16)
+        if len(reply) < 16 or struct.unpack('<I',reply[8:12])[0] != baudrate:
+            return False
+        previous = self.serial.baudrate
+        self.serial.baudrate = baudrate
+        time.sleep(0.05)
+        self.serial.reset_input_buffer()
+        cmd = self.CMD_0527 + struct.pack('<H',4) + self.sessTimestamp
+        cmd_crc = struct.pack('<H',crc16_ccitt(cmd))
+        self.uart_send_msg(b'\xAB\xCD' + struct.pack('<H',8) + cmd + cmd_crc + b'\xDC\xBA')
+        reply = self.serial.read(16)
+        if len(reply) < 16 or reply[:2] != b'\xAB\xCD':
+            self.serial.baudrate = previous
+            return False
+        return True
+
+    def read_eeprom(self,address,length):
+        # One command, the radio streams 128 byte frames until the last one
+        cmd = self.build_uart_command(self.CMD_EEPROM_READ, struct.pack('<HH',address,length) + self.sessTimestamp)
+        self.uart_send_msg(cmd)
+        data = b''
+        while True:
+            head = self.serial.read(4)
+            if len(head) < 4:
+                raise Exception('EEPROM read timed out')
+            size = struct.unpack('<H',head[2:4])[0]
+            msg_raw = head + self.serial.read(size + 4)
+            reply = msg_raw[:4] + payload_xor(msg_raw[4:-2]) + msg_raw[-2:]
+            offset,count,last,crc = struct.unpack('<HB?H',reply[8:14])
+            data += reply[16:16+count]
+            if last:
+                break
+        if len(data) != length:
+            raise Exception('EEPROM range refused')
+        if crc16_ccitt(data) != crc:
+            raise Exception('EEPROM read CRC mismatch')
+        return data
+
+    def write_eeprom(self,address,payload):
+        # Each chunk is acknowledged once written and read back by the radio
+        crc = 0
+        for i in range(0, len(payload), 128):
+            chunk = payload[i:i+128]
+            body = struct.pack('<HB?',address+i,len(chunk),i == 0) + self.sessTimestamp + chunk
+            self.uart_send_msg(self.build_uart_command(self.CMD_EEPROM_WRITE, body))
+            reply = self.uart_receive_msg(20)
+            if len(reply) < 20:
+                return False
+            offset,count,written,crc = struct.unpack('<HB?H',reply[8:14])
+            if not written:
+                return False
+        return crc == crc16_ccitt(payload)
+
+    def subscribe_telemetry(self,interval_ms):
+        # Samples keep coming every interval_ms (10ms steps) for as long as
+        # some frame reaches the radio at least every 5s, 0 gets one sample.
+        body = struct.pack('<B3x',min(interval_ms//10,255)) + self.sessTimestamp
+        self.uart_send_msg(self.build_uart_command(self.CMD_TELEMETRY, body))
+
+    def read_telemetry(self):
+        reply = self.uart_receive_msg(40)
+        if len(reply) < 40 or reply[4:6] != b'\x3E\x05':
+            return None
+        seq,dropped,freq,rssi,noise,glitch,sql,function,irq_mask,irq_time,poll_late = \
+            struct.unpack('<HHIHBB?BHII',reply[8:32])
+        return {'sequence':seq, 'dropped':dropped, 'frequency':freq*10, 'rssi':rssi,
+                'noise':noise, 'glitch':glitch, 'squelch_open':sql, 'function':function,
+                'interrupt_mask':irq_mask, 'interrupt_time_us':irq_time,
+                'poll_late_max_us':poll_late}
+
+    def subscribe_screen(self,subscribe=True):
+        # All 8 lines are sent first, then only changed columns while subscribed
+        body = struct.pack('<?3x',subscribe) + self.sessTimestamp
+        self.uart_send_msg(self.build_uart_command(self.CMD_SCREEN, body))
+
+    def read_screen_update(self,screen):
+        # screen is a list of 8 bytearrays of 128 columns, line 0 being the
+        # status line. Returns the line that changed or None on timeout.
+        head = self.serial.read(4)
+        if len(head) < 4:
+            return None
+        size = struct.unpack('<H',head[2:4])[0]
+        msg_raw = head + self.serial.read(size + 4)
+        reply = msg_raw[:4] + payload_xor(msg_raw[4:-2]) + msg_raw[-2:]
+        seq,line,column,length = struct.unpack('<HBBB',reply[8:13])
+        screen[line][column:column+length] = rle_decode(reply[16:-4])[:length]
+        return line
+
+    def get_screen(self):
+        screen = [bytearray(128) for i in range(8)]
+        self.subscribe_screen(False)
+        for i in range(8):
+            if self.read_screen_update(screen) is None:
+                break
+        return screen
+
+    def inject_keys(self,events=[]):
+        # events: [(key, pressed, held, delay_ms), ...], at most 16. A reply
+        # follows right away and then one per key once the screen has been
+        # redrawn for it.
+        body = struct.pack('<B3x',len(events)) + self.sessTimestamp
+        for key,pressed,held,delay in events:
+            body += struct.pack('<BBH',key,(1 if pressed else 0) | (2 if held else 0),delay//10)
+        self.uart_send_msg(self.build_uart_command(self.CMD_KEYS, body))
+        return self.read_key_state()
+
+    def read_key_state(self):
+        reply = self.uart_receive_msg(20)
+        if len(reply) < 20 or reply[4:6] != b'\x42\x05':
+            return None
+        time_us,key,pending,screen,function = struct.unpack('<IBBBB',reply[8:16])
+        return {'time_us':time_us, 'key':key if key != 255 else None, 'pending':pending,
+                'screen':screen, 'function':function}
+
+    def get_power_stats(self):
+        self.uart_send_msg(self.build_uart_command(self.CMD_POWER, self.sessTimestamp))
+        reply = self.uart_receive_msg(40)
+        if len(reply) < 40 or reply[4:6] != b'\x44\x05':
+            return None
+        data = struct.unpack('<6IHBB',reply[8:36])
+        ticks = list(data[:6])
+        return {'ticks':ticks, 'save_time':data[6], 'battery_save':data[7], 'function':data[8],
+                'current_ma':estimate_current(ticks, data[6])}
+
+    def get_energy_stats(self):
+        self.uart_send_msg(self.build_uart_command(self.CMD_ENERGY, self.sessTimestamp))
+        reply = self.uart_receive_msg(76)
+        if len(reply) < 76 or reply[4:6] != b'\x48\x05':
+            return None
+        data = struct.unpack('<15IB',reply[8:69])
+        stats = {'ticks':data[0], 'function':list(data[1:7]), 'rx_idle':data[7], 'radio_sleep':data[8],
+                 'backlight':data[9], 'tx_power':list(data[10:13]), 'clock_slow':data[13], 'busy_us':data[14],
+                 'current_function':data[15]}
+        stats['current_ma'] = estimate_energy_current(stats)
+        return stats
@@ -16,17 +16,32 @@
 
 #include <string.h>
 #include "driver/st7565.h"
-#include "external/printf/printf.h"
 #include "font.h"
 #include "ui/helper.h"
 #include "ui/inputbox.h"
 
+// The M0 has no divide instruction, so digits are counted out by repeated
+// subtraction of each power of ten instead of going through sprintf.
+static const uint32_t Powers[10] = {
+	1000000000U,
+	100000000U,
+	10000000U,
+	1000000U,
+	100000U,
+	10000U,
+	1000U,
+	100U,
+	10U,
+	1U,
+};
+
 void UI_GenerateChannelString(char *pString, uint8_t Channel)
 {
 	uint8_t i;
 
 	if (gInputBoxIndex == 0) {
-		sprintf(pString, "CH-%02d", Channel + 1);
+		strcpy(pString, "CH-");
+		UI_FormatNumber(pString + 3, Channel + 1, 2, 0);
 		return;
 	}
 
@@ -60,39 +75,59 @@ void UI_GenerateChannelStringEx(char *pString, bool bShowPrefix, uint8_t Channel
 	}
 
 	if (bShowPrefix) {
-		sprintf(pString, "CH-%03d", ChannelNumber + 1);
+		strcpy(pString, "CH-");
+		UI_FormatNumber(pString + 3, ChannelNumber + 1, 3, 0);
 	} else {
 		if (ChannelNumber == 0xFF) {
 			strcpy(pString, "NULL");
 		} else {
-			sprintf(pString, "%03d", ChannelNumber + 1);
+			UI_FormatNumber(pString, ChannelNumber + 1, 3, 0);
 		}
 	}
 }
 
 void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width, bool bCentered)
 {
-	uint32_t i, Length;
+	uint32_t i, Length, Fit;
 
 	Length = strlen(pString);
-	if (bCentered) {
+	if (bCentered && Length * Width <= (End - Start) + 1U) {
 		Start += (((End - Start) - (Length * Width)) + 1) / 2;
 	}
+	// Cyrillic text runs longer, stop at the last cell that fits on the LCD
+	if (Start + 8U > sizeof(gFrameBuffer[0])) {
+		return;
+	}
+	Fit = ((sizeof(gFrameBuffer[0]) - 8U - Start) / Width) + 1U;
+	if (Length > Fit) {
+		Length = Fit;
+	}
+	// gFontBig has a glyph for every Win1251 code. Codes without a letter
+	// in it, such as 0x80 to 0xBF other than YO, are blank cells.
 	for (i = 0; i < Length; i++) {
-		if (pString[i] - ' ' < 0x5F) {
-			uint8_t Index = pString[i] - ' ';
-			memcpy(gFrameBuffer[Line + 0] + (i * Width) + Start, &gFontBig[Index][0], 8);
-			memcpy(gFrameBuffer[Line + 1] + (i * Width) + Start, &gFontBig[Index][8], 8);
-		}
+		const uint8_t *pGlyph = FONT_GetBig((uint8_t)pString[i]);
+
+		memcpy(gFrameBuffer[Line + 0] + (i * Width) + Start, pGlyph + 0, 8);
+		memcpy(gFrameBuffer[Line + 1] + (i * Width) + Start, pGlyph + 8, 8);
 	}
 }
 
+// Runs are laid out by gen-runs.py, page Line first and then Line + 1
+void UI_PrintRun(UI_RUN_ID Run, uint8_t Line)
+{
+	const UI_Run_t *pRun = &gRuns[Run];
+	const uint8_t *pData = gRunData + pRun->Offset;
+
+	memcpy(gFrameBuffer[Line + 0] + pRun->Start, pData, pRun->Columns);
+	memcpy(gFrameBuffer[Line + 1] + pRun->Start, pData + pRun->Columns, pRun->Columns);
+}
+
 void UI_DisplayFrequency(const char *pDigits, uint8_t X, uint8_t Y,
                          bool bDisplayLeadingZero, bool bFlag) {
   char String[8];
   char baseDigit = '0';
   uint8_t d;
-  sprintf(String, "---.---");
+  strcpy(String, "---.---");
   for (int i = 0; i < 3; i++) {
     d = pDigits[i];
     if (d < 10) {
@@ -117,3 +152,68 @@ void UI_DisplaySmallDigits(uint8_t Size, const char *pString, uint8_t X, uint8_t
 	}
 }
 
+// Writes Value with at least MinDigits digits, the last Decimals of them
+// after a decimal point. Returns the end of the string.
+char *UI_FormatNumber(char *pString, uint32_t Value, uint8_t MinDigits, uint8_t Decimals)
+{
+	char *pStart = pString;
+	uint8_t i;
+
+	for (i = 0; i < 10; i++) {
+		const uint8_t Position = 9 - i;
+		char Digit = '0';
+
+		while (Value >= Powers[i]) {
+			Value -= Powers[i];
+			Digit++;
+		}
+		if (pString == pStart && Digit == '0' && Position >= MinDigits) {
+			continue;
+		}
+		*pString++ = Digit;
+		if (Decimals && Position == Decimals) {
+			*pString++ = '.';
+		}
+	}
+	*pString = 0;
+
+	return pString;
+}
+
+// Frequency in 10Hz units, as MHz
+char *UI_FormatFrequency(char *pString, uint32_t Frequency)
+{
+	return UI_FormatNumber(pString, Frequency, 6, 5);
+}
+
+// Voltage in 10mV units
+char *UI_FormatVoltage(char *pString, uint16_t Voltage)
+{
+	pString = UI_FormatNumber(pString, Voltage, 3, 2);
+	*pString++ = 'V';
+	*pString = 0;
+
+	return pString;
+}
+
+// Tone in 0.1Hz units
+char *UI_FormatCTCSS(char *pString, uint16_t Tone)
+{
+	pString = UI_FormatNumber(pString, Tone, 2, 1);
+	strcpy(pString, "Hz");
+
+	return pString + 2;
+}
+
+// Code as three octal digits, Suffix is N or I for the polarity
+char *UI_FormatDCS(char *pString, uint16_t Code, char Suffix)
+{
+	pString[0] = 'D';
+	pString[1] = '0' + ((Code >> 6) & 7U);
+	pString[2] = '0' + ((Code >> 3) & 7U);
+	pString[3] = '0' + (Code & 7U);
+	pString[4] = Suffix;
+	pString[5] = 0;
+
+	return pString + 5;
+}
@@ -19,12 +19,19 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include "ui/runs.h"
 
 void UI_GenerateChannelString(char *pString, uint8_t Channel);
 void UI_GenerateChannelStringEx(char *pString, bool bShowPrefix, uint8_t ChannelNumber);
 void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width, bool bCentered);
+void UI_PrintRun(UI_RUN_ID Run, uint8_t Line);
 void UI_DisplayFrequency(const char *pDigits, uint8_t X, uint8_t Y, bool bDisplayLeadingZero, bool bFlag);
 void UI_DisplaySmallDigits(uint8_t Size, const char *pString, uint8_t X, uint8_t Y);
+char *UI_FormatNumber(char *pString, uint32_t Value, uint8_t MinDigits, uint8_t Decimals);
+char *UI_FormatFrequency(char *pString, uint32_t Frequency);
+char *UI_FormatVoltage(char *pString, uint16_t Voltage);
+char *UI_FormatCTCSS(char *pString, uint16_t Tone);
+char *UI_FormatDCS(char *pString, uint16_t Code, char Suffix);
 
 #endif
 
@@ -27,349 +27,479 @@
 #include "ui/inputbox.h"
 #include "ui/main.h"
 
-void UI_DisplayMain(void)
-{
-	char String[16];
-	uint8_t i;
+// Each VFO is drawn as a top region, pages Line and Line + 1, and an info
+// region on page Line + 2, or as the DTMF area on pages i * 3 to i * 3 + 3.
+// A region keeps the inputs it was last drawn with and is only drawn again
+// when they change. Only the pages that were drawn are sent to the LCD.
+enum {
+	MARKER_NONE = 0U,
+	MARKER_DEFAULT,
+	MARKER_NOT_DEFAULT,
+};
 
-	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
-	if (gEeprom.KEY_LOCK && gKeypadLocked) {
-		UI_PrintString("Long Press #", 0, 127, 1, 8, true);
-		UI_PrintString("To Unlock", 0, 127, 3, 8, true);
-		ST7565_BlitFullScreen();
-		return;
+enum {
+	INDICATOR_NONE = 0U,
+	INDICATOR_TX,
+	INDICATOR_RX,
+};
+
+enum {
+	TX_STATE_OTHER = 0U,
+	TX_STATE_THIS,
+	TX_STATE_NONE,
+};
+
+#define MODULATION_AM 0xFFU
+
+typedef struct {
+	uint8_t Marker;
+	uint8_t Indicator;
+	uint8_t ScreenChannel;
+	uint8_t State;
+	uint8_t DisplayMode;
+	uint8_t Attributes;
+	uint8_t InputBoxIndex;
+	char InputBox[8];
+	uint32_t Frequency;
+	char Name[16];
+} MAIN_Top_t;
+
+typedef struct {
+	uint8_t Level;
+	uint8_t Modulation;
+	uint8_t Power;
+	uint8_t Offset;
+	bool bReverse;
+	bool bNarrow;
+	bool bDTMF;
+	bool bScramble;
+} MAIN_Info_t;
+
+typedef struct {
+	bool bIsDTMF;
+	char Text[2][16];
+	MAIN_Top_t Top;
+	MAIN_Info_t Info;
+} MAIN_Vfo_t;
+
+static MAIN_Vfo_t Cache[2];
+static bool bIsCacheValid;
+static bool bIsLockShown;
+
+static uint8_t MAIN_GetTxChannel(void)
+{
+	if (gEeprom.CROSS_BAND_RX_TX == CROSS_BAND_OFF) {
+		return gEeprom.RX_CHANNEL;
 	}
 
-	for (i = 0; i < 2; i++) {
-		uint8_t *pLine0;
-		uint8_t *pLine1;
-		uint8_t Line;
-		uint8_t Channel;
-		bool bIsSameVfo;
-
-		if (i == 0) {
-			pLine0 = gFrameBuffer[0];
-			pLine1 = gFrameBuffer[1];
-			Line = 0;
-		} else {
-			pLine0 = gFrameBuffer[4];
-			pLine1 = gFrameBuffer[5];
-			Line = 4;
-		}
+	return gEeprom.TX_CHANNEL;
+}
 
-		Channel = gEeprom.TX_CHANNEL;
-		bIsSameVfo = !!(Channel == i);
+static bool MAIN_GetDTMF(char Text[2][16])
+{
+	char Contact[16];
 
-		if (gEeprom.DUAL_WATCH != DUAL_WATCH_OFF && gRxVfoIsActive) {
-			Channel = gEeprom.RX_CHANNEL;
-		}
+	if (gDTMF_CallState == DTMF_CALL_STATE_NONE && !gDTMF_IsTx && !gDTMF_InputMode) {
+		return false;
+	}
 
-		if (Channel != i) {
-			if (gDTMF_CallState != DTMF_CALL_STATE_NONE || gDTMF_IsTx || gDTMF_InputMode) {
-				char Contact[16];
-
-				if (!gDTMF_InputMode) {
-					if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT) {
-						if (gDTMF_State == DTMF_STATE_CALL_OUT_RSP) {
-							strcpy(String, "CALL OUT(RSP)");
-						} else {
-							strcpy(String, "CALL OUT");
-						}
-					} else if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED) {
-						if (DTMF_FindContact(gDTMF_Caller, Contact)) {
-							sprintf(String, "CALL:%s", Contact);
-						} else {
-							sprintf(String, "CALL:%s", gDTMF_Caller);
-						}
-					} else if (gDTMF_IsTx) {
-						if (gDTMF_State == DTMF_STATE_TX_SUCC) {
-							strcpy(String, "DTMF TX(SUCC)");
-						} else {
-							strcpy(String, "DTMF TX");
-						}
-					}
-				} else {
-					sprintf(String, ">%s", gDTMF_InputBox);
-				}
-				UI_PrintString(String, 2, 127, i * 3, 8, false);
-
-				memset(String, 0, sizeof(String));
-				memset(Contact, 0, sizeof(Contact));
-
-				if (!gDTMF_InputMode) {
-					if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT) {
-						if (DTMF_FindContact(gDTMF_String, Contact)) {
-							sprintf(String, ">%s", Contact);
-						} else {
-							sprintf(String, ">%s", gDTMF_String);
-						}
-					} else if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED) {
-						if (DTMF_FindContact(gDTMF_Callee, Contact)) {
-							sprintf(String, ">%s", Contact);
-						} else {
-							sprintf(String, ">%s", gDTMF_Callee);
-						}
-					} else if (gDTMF_IsTx) {
-						sprintf(String, ">%s", gDTMF_String);
-					}
-				}
-				UI_PrintString(String, 2, 127, 2 + (i * 3), 8, false);
-				continue;
-			} else if (bIsSameVfo) {
-				memcpy(pLine0 + 2, BITMAP_VFO_Default, sizeof(BITMAP_VFO_Default));
+	if (!gDTMF_InputMode) {
+		if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT) {
+			if (gDTMF_State == DTMF_STATE_CALL_OUT_RSP) {
+				strcpy(Text[0], "CALL OUT(RSP)");
+			} else {
+				strcpy(Text[0], "CALL OUT");
 			}
-		} else {
-			if (bIsSameVfo) {
-				memcpy(pLine0 + 2, BITMAP_VFO_Default, sizeof(BITMAP_VFO_Default));
+		} else if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED) {
+			if (DTMF_FindContact(gDTMF_Caller, Contact)) {
+				sprintf(Text[0], "CALL:%s", Contact);
+			} else {
+				sprintf(Text[0], "CALL:%s", gDTMF_Caller);
+			}
+		} else if (gDTMF_IsTx) {
+			if (gDTMF_State == DTMF_STATE_TX_SUCC) {
+				strcpy(Text[0], "DTMF TX(SUCC)");
 			} else {
-				memcpy(pLine0 + 2, BITMAP_VFO_NotDefault, sizeof(BITMAP_VFO_NotDefault));
+				strcpy(Text[0], "DTMF TX");
 			}
 		}
+	} else {
+		sprintf(Text[0], ">%s", gDTMF_InputBox);
+	}
 
-		// 0x8EE2
-		uint32_t SomeValue = 0;
+	memset(Contact, 0, sizeof(Contact));
 
-		if (gCurrentFunction == FUNCTION_TRANSMIT) {
-			if (gAlarmState == ALARM_STATE_ALARM) {
-				SomeValue = 2;
+	if (!gDTMF_InputMode) {
+		if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT) {
+			if (DTMF_FindContact(gDTMF_String, Contact)) {
+				sprintf(Text[1], ">%s", Contact);
 			} else {
-				if (gEeprom.CROSS_BAND_RX_TX == CROSS_BAND_OFF) {
-					Channel = gEeprom.RX_CHANNEL;
-				} else {
-					Channel = gEeprom.TX_CHANNEL;
-				}
-				if (Channel == i) {
-					SomeValue = 1;
-					memcpy(pLine0 + 14, BITMAP_TX, sizeof(BITMAP_TX));
-				}
+				sprintf(Text[1], ">%s", gDTMF_String);
 			}
-		} else {
-			SomeValue = 2;
-			if ((gCurrentFunction == FUNCTION_RECEIVE || gCurrentFunction == FUNCTION_MONITOR) && gEeprom.RX_CHANNEL == i) {
-				memcpy(pLine0 + 14, BITMAP_RX, sizeof(BITMAP_RX));
+		} else if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED) {
+			if (DTMF_FindContact(gDTMF_Callee, Contact)) {
+				sprintf(Text[1], ">%s", Contact);
+			} else {
+				sprintf(Text[1], ">%s", gDTMF_Callee);
 			}
+		} else if (gDTMF_IsTx) {
+			sprintf(Text[1], ">%s", gDTMF_String);
 		}
+	}
 
-		// 0x8F3C
-		if (IS_MR_CHANNEL(gEeprom.ScreenChannel[i])) {
-			memcpy(pLine1 + 2, BITMAP_M, sizeof(BITMAP_M));
-			if (gInputBoxIndex == 0 || gEeprom.TX_CHANNEL != i) {
-				NUMBER_ToDigits(gEeprom.ScreenChannel[i] + 1, String);
-			} else {
-				memcpy(String + 5, gInputBox, 3);
-			}
-			UI_DisplaySmallDigits(3, String + 5, 10, Line + 1);
-		} else if (IS_FREQ_CHANNEL(gEeprom.ScreenChannel[i])) {
-			char c;
+	return true;
+}
 
-			memcpy(pLine1 + 14, BITMAP_F, sizeof(BITMAP_F));
-			c = (gEeprom.ScreenChannel[i] - FREQ_CHANNEL_FIRST) + 1;
-			UI_DisplaySmallDigits(1, &c, 22, Line + 1);
-		} else {
-			memcpy(pLine1 + 7, BITMAP_NarrowBand, sizeof(BITMAP_NarrowBand));
-			if (gInputBoxIndex == 0 || gEeprom.TX_CHANNEL != i) {
-				NUMBER_ToDigits((gEeprom.ScreenChannel[i] - NOAA_CHANNEL_FIRST) + 1, String);
+// Collects everything the regions of VFO i are drawn from. The structure is
+// cleared first so it can be compared with memcmp.
+static void MAIN_GetVfo(uint8_t i, MAIN_Vfo_t *pVfo)
+{
+	const VFO_Info_t *pInfo = &gEeprom.VfoInfo[i];
+	MAIN_Top_t *pTop = &pVfo->Top;
+	MAIN_Info_t *pLevels = &pVfo->Info;
+	const bool bIsSameVfo = (gEeprom.TX_CHANNEL == i);
+	uint8_t Channel;
+	uint8_t TxState;
+
+	memset(pVfo, 0, sizeof(*pVfo));
+
+	Channel = gEeprom.TX_CHANNEL;
+	if (gEeprom.DUAL_WATCH != DUAL_WATCH_OFF && gRxVfoIsActive) {
+		Channel = gEeprom.RX_CHANNEL;
+	}
+
+	if (Channel != i) {
+		if (MAIN_GetDTMF(pVfo->Text)) {
+			pVfo->bIsDTMF = true;
+			return;
+		}
+		if (bIsSameVfo) {
+			pTop->Marker = MARKER_DEFAULT;
+		}
+	} else if (bIsSameVfo) {
+		pTop->Marker = MARKER_DEFAULT;
+	} else {
+		pTop->Marker = MARKER_NOT_DEFAULT;
+	}
+
+	TxState = TX_STATE_NONE;
+	if (gCurrentFunction == FUNCTION_TRANSMIT) {
+		if (gAlarmState != ALARM_STATE_ALARM) {
+			if (MAIN_GetTxChannel() == i) {
+				TxState = TX_STATE_THIS;
+				pTop->Indicator = INDICATOR_TX;
 			} else {
-				String[6] = gInputBox[0];
-				String[7] = gInputBox[1];
+				TxState = TX_STATE_OTHER;
 			}
-			UI_DisplaySmallDigits(2, String + 6, 15, Line + 1);
 		}
+	} else if ((gCurrentFunction == FUNCTION_RECEIVE || gCurrentFunction == FUNCTION_MONITOR) && gEeprom.RX_CHANNEL == i) {
+		pTop->Indicator = INDICATOR_RX;
+	}
+
+	pTop->ScreenChannel = gEeprom.ScreenChannel[i];
+	if (bIsSameVfo && gInputBoxIndex) {
+		pTop->InputBoxIndex = gInputBoxIndex;
+		memcpy(pTop->InputBox, gInputBox, sizeof(pTop->InputBox));
+	}
 
-		// 0x8FEC
+	pTop->State = VfoState[i];
+	if (gCurrentFunction == FUNCTION_TRANSMIT && gAlarmState == ALARM_STATE_ALARM && MAIN_GetTxChannel() == i) {
+		pTop->State = VFO_STATE_ALARM;
+	}
 
-		uint8_t State = VfoState[i];
-		if (gCurrentFunction == FUNCTION_TRANSMIT && gAlarmState == ALARM_STATE_ALARM) {
-			if (gEeprom.CROSS_BAND_RX_TX == CROSS_BAND_OFF) {
-				Channel = gEeprom.RX_CHANNEL;
+	if (pTop->State == VFO_STATE_NORMAL && !(pTop->InputBoxIndex && IS_FREQ_CHANNEL(pTop->ScreenChannel))) {
+		if (!IS_MR_CHANNEL(pTop->ScreenChannel) || gEeprom.CHANNEL_DISPLAY_MODE == MDF_FREQUENCY) {
+			pTop->DisplayMode = MDF_FREQUENCY;
+			if (TxState == TX_STATE_THIS) {
+				pTop->Frequency = pInfo->pReverse->Frequency;
 			} else {
-				Channel = gEeprom.TX_CHANNEL;
+				pTop->Frequency = pInfo->pCurrent->Frequency;
 			}
-			if (Channel == i) {
-				State = VFO_STATE_ALARM;
+			if (IS_MR_CHANNEL(pTop->ScreenChannel)) {
+				pTop->Attributes = gMR_ChannelAttributes[pTop->ScreenChannel] & (MR_CH_SCANLIST1 | MR_CH_SCANLIST2);
 			}
-		}
-		if (State) {
-			uint8_t Width = 10;
-
-			memset(String, 0, sizeof(String));
-			switch (State) {
-			case 1:
-				strcpy(String, "BUSY");
-				Width = 15;
-				break;
-			case 2:
-				strcpy(String, "Discharged");
-				break;
-			case 3:
-				strcpy(String, "Disabled");
-				break;
-			case 4:
-				strcpy(String, "Timeout");
-				break;
-			case 5:
-				strcpy(String, "Alarm");
-				break;
-			case 6:
-				sprintf(String, "Vol high");
-				Width = 8;
-				break;
-			}
-			UI_PrintString(String, 31, 111, i * 4, Width, true);
 		} else {
-			if (gInputBoxIndex && IS_FREQ_CHANNEL(gEeprom.ScreenChannel[i]) && gEeprom.TX_CHANNEL == i) {
-				UI_DisplayFrequency(gInputBox, 31, i * 4, true, false);
-			} else {
-        uint32_t fDisplay;
-
-        bool isMRChannel = IS_MR_CHANNEL(gEeprom.ScreenChannel[i]);
-        if (!isMRChannel ||
-            (isMRChannel && gEeprom.CHANNEL_DISPLAY_MODE == MDF_FREQUENCY)) {
-          if (gCurrentFunction == FUNCTION_TRANSMIT) {
-            if (gEeprom.CROSS_BAND_RX_TX == CROSS_BAND_OFF) {
-              Channel = gEeprom.RX_CHANNEL;
-            } else {
-              Channel = gEeprom.TX_CHANNEL;
-            }
-            if (Channel == i) {
-              fDisplay = gEeprom.VfoInfo[i].pReverse->Frequency;
-            } else {
-              fDisplay = gEeprom.VfoInfo[i].pCurrent->Frequency;
-            }
-          } else {
-            fDisplay = gEeprom.VfoInfo[i].pCurrent->Frequency;
-          }
-          if (IS_MR_CHANNEL(gEeprom.ScreenChannel[i])) {
-            const uint8_t Attributes =
-                gMR_ChannelAttributes[gEeprom.ScreenChannel[i]];
-            if (Attributes & MR_CH_SCANLIST1) {
-              memcpy(pLine0 + 113, BITMAP_ScanList, sizeof(BITMAP_ScanList));
-            }
-            if (Attributes & MR_CH_SCANLIST2) {
-              memcpy(pLine0 + 120, BITMAP_ScanList, sizeof(BITMAP_ScanList));
-            }
-          }
-          sprintf(String, "%d.%05d", fDisplay / 100000, fDisplay % 100000);
-          UI_PrintString(String, 8, 127, Line, 8, 1);
-        } else {
-          switch (gEeprom.CHANNEL_DISPLAY_MODE) {
-          case MDF_CHANNEL:
-            sprintf(String, "CH-%03d", gEeprom.ScreenChannel[i] + 1);
-            UI_PrintString(String, 31, 112, i * 4, 8, true);
-            break;
-          case MDF_NAME:
-            if (gEeprom.VfoInfo[i].Name[0] == 0 ||
-                gEeprom.VfoInfo[i].Name[0] == 0xFF) {
-              sprintf(String, "CH-%03d", gEeprom.ScreenChannel[i] + 1);
-              UI_PrintString(String, 31, 112, i * 4, 8, true);
-            } else {
-              UI_PrintString(gEeprom.VfoInfo[i].Name, 31, 112, i * 4, 8, true);
-            }
-            break;
-          }
-        }
+			pTop->DisplayMode = gEeprom.CHANNEL_DISPLAY_MODE;
+			if (pTop->DisplayMode == MDF_NAME) {
+				memcpy(pTop->Name, pInfo->Name, sizeof(pTop->Name));
 			}
 		}
+	}
 
-		// 0x926E
-		uint8_t Level = 0;
-
-		if (SomeValue == 1) {
-				if (gRxVfo->OUTPUT_POWER == OUTPUT_POWER_LOW) {
-					Level = 2;
-				} else if (gRxVfo->OUTPUT_POWER == OUTPUT_POWER_MID) {
-					Level = 4;
-				} else {
-					Level = 6;
-				}		
-		} else if (SomeValue == 2) {
-			if (gVFO_RSSI_Level[i]) {
-				Level = gVFO_RSSI_Level[i];
-			}
+	if (TxState == TX_STATE_THIS) {
+		if (gRxVfo->OUTPUT_POWER == OUTPUT_POWER_LOW) {
+			pLevels->Level = 2;
+		} else if (gRxVfo->OUTPUT_POWER == OUTPUT_POWER_MID) {
+			pLevels->Level = 4;
+		} else {
+			pLevels->Level = 6;
 		}
+	} else if (TxState == TX_STATE_NONE) {
+		pLevels->Level = gVFO_RSSI_Level[i];
+	}
 
-		// TODO: not quite how the original does it, but it's quite entangled in Ghidra.
-		if (Level) {
-			memcpy(pLine1 + 128 + 0, BITMAP_Antenna, sizeof(BITMAP_Antenna));
-			memcpy(pLine1 + 128 + 5, BITMAP_AntennaLevel1, sizeof(BITMAP_AntennaLevel1));
-			if (Level >= 2) {
-				memcpy(pLine1 + 128 + 8, BITMAP_AntennaLevel2, sizeof(BITMAP_AntennaLevel2));
-			}
-			if (Level >= 3) {
-				memcpy(pLine1 + 128 + 11, BITMAP_AntennaLevel3, sizeof(BITMAP_AntennaLevel3));
-			}
-			if (Level >= 4) {
-				memcpy(pLine1 + 128 + 14, BITMAP_AntennaLevel4, sizeof(BITMAP_AntennaLevel4));
-			}
-			if (Level >= 5) {
-				memcpy(pLine1 + 128 + 17, BITMAP_AntennaLevel5, sizeof(BITMAP_AntennaLevel5));
-			}
-			if (Level >= 6) {
-				memcpy(pLine1 + 128 + 20, BITMAP_AntennaLevel6, sizeof(BITMAP_AntennaLevel6));
-			}
-		}
+	if (pInfo->IsAM) {
+		pLevels->Modulation = MODULATION_AM;
+	} else if (TxState == TX_STATE_THIS) {
+		pLevels->Modulation = pInfo->pReverse->CodeType;
+	} else {
+		pLevels->Modulation = pInfo->pCurrent->CodeType;
+	}
+
+	pLevels->Power = pInfo->OUTPUT_POWER;
+	if (pInfo->ConfigRX.Frequency != pInfo->ConfigTX.Frequency) {
+		pLevels->Offset = pInfo->FREQUENCY_DEVIATION_SETTING;
+	}
+	pLevels->bReverse = pInfo->FrequencyReverse;
+	pLevels->bNarrow = (pInfo->CHANNEL_BANDWIDTH == BANDWIDTH_NARROW);
+	pLevels->bDTMF = pInfo->DTMF_DECODING_ENABLE;
+	pLevels->bScramble = pInfo->SCRAMBLING_TYPE && gSetting_ScrambleEnable;
+}
+
+static void MAIN_DrawDTMF(uint8_t i, const MAIN_Vfo_t *pVfo)
+{
+	memset(gFrameBuffer[i * 3], 0, sizeof(gFrameBuffer[0]) * 4);
+	UI_PrintString(pVfo->Text[0], 2, 127, i * 3, 8, false);
+	UI_PrintString(pVfo->Text[1], 2, 127, 2 + (i * 3), 8, false);
+}
+
+static void MAIN_DrawTop(uint8_t i, const MAIN_Top_t *pTop)
+{
+	const uint8_t Line = i * 4;
+	uint8_t *pLine0 = gFrameBuffer[Line];
+	uint8_t *pLine1 = gFrameBuffer[Line + 1];
+	char String[16];
+
+	memset(pLine0, 0, sizeof(gFrameBuffer[0]) * 2);
+
+	if (pTop->Marker == MARKER_DEFAULT) {
+		memcpy(pLine0 + 2, BITMAP_VFO_Default, sizeof(BITMAP_VFO_Default));
+	} else if (pTop->Marker == MARKER_NOT_DEFAULT) {
+		memcpy(pLine0 + 2, BITMAP_VFO_NotDefault, sizeof(BITMAP_VFO_NotDefault));
+	}
 
-		// 0x931E
-		if (gEeprom.VfoInfo[i].IsAM) {
-			memcpy(pLine1 + 128 + 27, BITMAP_AM, sizeof(BITMAP_AM));
+	if (pTop->Indicator == INDICATOR_TX) {
+		memcpy(pLine0 + 14, BITMAP_TX, sizeof(BITMAP_TX));
+	} else if (pTop->Indicator == INDICATOR_RX) {
+		memcpy(pLine0 + 14, BITMAP_RX, sizeof(BITMAP_RX));
+	}
+
+	if (IS_MR_CHANNEL(pTop->ScreenChannel)) {
+		memcpy(pLine1 + 2, BITMAP_M, sizeof(BITMAP_M));
+		if (pTop->InputBoxIndex == 0) {
+			NUMBER_ToDigits(pTop->ScreenChannel + 1, String);
 		} else {
-			const FREQ_Config_t *pConfig;
+			memcpy(String + 5, pTop->InputBox, 3);
+		}
+		UI_DisplaySmallDigits(3, String + 5, 10, Line + 1);
+	} else if (IS_FREQ_CHANNEL(pTop->ScreenChannel)) {
+		char c;
 
-			if (SomeValue == 1) {
-				pConfig = gEeprom.VfoInfo[i].pReverse;
-			} else {
-				pConfig = gEeprom.VfoInfo[i].pCurrent;
-			}
-			switch (pConfig->CodeType) {
-			case CODE_TYPE_CONTINUOUS_TONE:
-				memcpy(pLine1 + 128 + 27, BITMAP_CT, sizeof(BITMAP_CT));
-				break;
-			case CODE_TYPE_DIGITAL:
-			case CODE_TYPE_REVERSE_DIGITAL:
-				memcpy(pLine1 + 128 + 24, BITMAP_DCS, sizeof(BITMAP_DCS));
-				break;
-			default:
-				break;
-			}
+		memcpy(pLine1 + 14, BITMAP_F, sizeof(BITMAP_F));
+		c = (pTop->ScreenChannel - FREQ_CHANNEL_FIRST) + 1;
+		UI_DisplaySmallDigits(1, &c, 22, Line + 1);
+	} else {
+		memcpy(pLine1 + 7, BITMAP_NarrowBand, sizeof(BITMAP_NarrowBand));
+		if (pTop->InputBoxIndex == 0) {
+			NUMBER_ToDigits((pTop->ScreenChannel - NOAA_CHANNEL_FIRST) + 1, String);
+		} else {
+			String[6] = pTop->InputBox[0];
+			String[7] = pTop->InputBox[1];
 		}
+		UI_DisplaySmallDigits(2, String + 6, 15, Line + 1);
+	}
 
-		// 0x936C
-		switch (gEeprom.VfoInfo[i].OUTPUT_POWER) {
-		case OUTPUT_POWER_LOW:
-			memcpy(pLine1 + 128 + 44, BITMAP_PowerLow, sizeof(BITMAP_PowerLow));
+	if (pTop->State) {
+		uint8_t Width = 10;
+
+		memset(String, 0, sizeof(String));
+		switch (pTop->State) {
+		case VFO_STATE_BUSY:
+			strcpy(String, "BUSY");
+			Width = 15;
+			break;
+		case VFO_STATE_BAT_LOW:
+			strcpy(String, "Discharged");
+			break;
+		case VFO_STATE_TX_DISABLE:
+			strcpy(String, "Disabled");
+			break;
+		case VFO_STATE_TIMEOUT:
+			strcpy(String, "Timeout");
 			break;
-		case OUTPUT_POWER_MID:
-			memcpy(pLine1 + 128 + 44, BITMAP_PowerMid, sizeof(BITMAP_PowerMid));
+		case VFO_STATE_ALARM:
+			strcpy(String, "Alarm");
 			break;
-		case OUTPUT_POWER_HIGH:
-			memcpy(pLine1 + 128 + 44, BITMAP_PowerHigh, sizeof(BITMAP_PowerHigh));
+		case VFO_STATE_VOL_HIGH:
+			strcpy(String, "Vol high");
+			Width = 8;
 			break;
 		}
+		UI_PrintString(String, 31, 111, Line, Width, true);
+	} else if (pTop->InputBoxIndex && IS_FREQ_CHANNEL(pTop->ScreenChannel)) {
+		UI_DisplayFrequency(pTop->InputBox, 31, Line, true, false);
+	} else if (pTop->DisplayMode == MDF_FREQUENCY) {
+		if (pTop->Attributes & MR_CH_SCANLIST1) {
+			memcpy(pLine0 + 113, BITMAP_ScanList, sizeof(BITMAP_ScanList));
+		}
+		if (pTop->Attributes & MR_CH_SCANLIST2) {
+			memcpy(pLine0 + 120, BITMAP_ScanList, sizeof(BITMAP_ScanList));
+		}
+		UI_FormatFrequency(String, pTop->Frequency);
+		UI_PrintString(String, 8, 127, Line, 8, true);
+	} else if (pTop->DisplayMode == MDF_NAME && pTop->Name[0] != 0) {
+		UI_PrintString(pTop->Name, 31, 112, Line, 8, true);
+	} else {
+		strcpy(String, "CH-");
+		UI_FormatNumber(String + 3, pTop->ScreenChannel + 1, 3, 0);
+		UI_PrintString(String, 31, 112, Line, 8, true);
+	}
+}
 
-		if (gEeprom.VfoInfo[i].ConfigRX.Frequency != gEeprom.VfoInfo[i].ConfigTX.Frequency) {
-			if (gEeprom.VfoInfo[i].FREQUENCY_DEVIATION_SETTING == FREQUENCY_DEVIATION_ADD) {
-				memcpy(pLine1 + 128 + 54, BITMAP_Add, sizeof(BITMAP_Add));
-			}
-			if (gEeprom.VfoInfo[i].FREQUENCY_DEVIATION_SETTING == FREQUENCY_DEVIATION_SUB) {
-				memcpy(pLine1 + 128 + 54, BITMAP_Sub, sizeof(BITMAP_Sub));
-			}
+static void MAIN_DrawInfo(uint8_t i, const MAIN_Info_t *pInfo)
+{
+	uint8_t *pLine = gFrameBuffer[(i * 4) + 2];
+
+	memset(pLine, 0, sizeof(gFrameBuffer[0]));
+
+	// TODO: not quite how the original does it, but it's quite entangled in Ghidra.
+	if (pInfo->Level) {
+		memcpy(pLine + 0, BITMAP_Antenna, sizeof(BITMAP_Antenna));
+		memcpy(pLine + 5, BITMAP_AntennaLevel1, sizeof(BITMAP_AntennaLevel1));
+		if (pInfo->Level >= 2) {
+			memcpy(pLine + 8, BITMAP_AntennaLevel2, sizeof(BITMAP_AntennaLevel2));
+		}
+		if (pInfo->Level >= 3) {
+			memcpy(pLine + 11, BITMAP_AntennaLevel3, sizeof(BITMAP_AntennaLevel3));
+		}
+		if (pInfo->Level >= 4) {
+			memcpy(pLine + 14, BITMAP_AntennaLevel4, sizeof(BITMAP_AntennaLevel4));
+		}
+		if (pInfo->Level >= 5) {
+			memcpy(pLine + 17, BITMAP_AntennaLevel5, sizeof(BITMAP_AntennaLevel5));
+		}
+		if (pInfo->Level >= 6) {
+			memcpy(pLine + 20, BITMAP_AntennaLevel6, sizeof(BITMAP_AntennaLevel6));
+		}
+	}
+
+	switch (pInfo->Modulation) {
+	case MODULATION_AM:
+		memcpy(pLine + 27, BITMAP_AM, sizeof(BITMAP_AM));
+		break;
+	case CODE_TYPE_CONTINUOUS_TONE:
+		memcpy(pLine + 27, BITMAP_CT, sizeof(BITMAP_CT));
+		break;
+	case CODE_TYPE_DIGITAL:
+	case CODE_TYPE_REVERSE_DIGITAL:
+		memcpy(pLine + 24, BITMAP_DCS, sizeof(BITMAP_DCS));
+		break;
+	default:
+		break;
+	}
 
+	switch (pInfo->Power) {
+	case OUTPUT_POWER_LOW:
+		memcpy(pLine + 44, BITMAP_PowerLow, sizeof(BITMAP_PowerLow));
+		break;
+	case OUTPUT_POWER_MID:
+		memcpy(pLine + 44, BITMAP_PowerMid, sizeof(BITMAP_PowerMid));
+		break;
+	case OUTPUT_POWER_HIGH:
+		memcpy(pLine + 44, BITMAP_PowerHigh, sizeof(BITMAP_PowerHigh));
+		break;
+	}
+
+	if (pInfo->Offset == FREQUENCY_DEVIATION_ADD) {
+		memcpy(pLine + 54, BITMAP_Add, sizeof(BITMAP_Add));
+	} else if (pInfo->Offset == FREQUENCY_DEVIATION_SUB) {
+		memcpy(pLine + 54, BITMAP_Sub, sizeof(BITMAP_Sub));
+	}
+
+	if (pInfo->bReverse) {
+		memcpy(pLine + 64, BITMAP_ReverseMode, sizeof(BITMAP_ReverseMode));
+	}
+	if (pInfo->bNarrow) {
+		memcpy(pLine + 74, BITMAP_NarrowBand, sizeof(BITMAP_NarrowBand));
+	}
+	if (pInfo->bDTMF) {
+		memcpy(pLine + 84, BITMAP_DTMF, sizeof(BITMAP_DTMF));
+	}
+	if (pInfo->bScramble) {
+		memcpy(pLine + 110, BITMAP_Scramble, sizeof(BITMAP_Scramble));
+	}
+}
+
+void UI_InvalidateMain(void)
+{
+	bIsCacheValid = false;
+	bIsLockShown = false;
+}
+
+void UI_DisplayMain(void)
+{
+	MAIN_Vfo_t Vfo[2];
+	uint8_t Dirty;
+	uint8_t Line;
+	uint8_t i;
+
+	if (gEeprom.KEY_LOCK && gKeypadLocked) {
+		if (!bIsLockShown) {
+			memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+			UI_PrintRun(UI_RUN_LONG_PRESS, 1);
+			UI_PrintRun(UI_RUN_TO_UNLOCK, 3);
+			ST7565_BlitFullScreen();
+			bIsLockShown = true;
+			bIsCacheValid = false;
 		}
+		return;
+	}
+	bIsLockShown = false;
 
-		if (gEeprom.VfoInfo[i].FrequencyReverse) {
-			memcpy(pLine1 + 128 + 64, BITMAP_ReverseMode, sizeof(BITMAP_ReverseMode));
+	// The DTMF area overlaps both VFOs, switching to or from it redraws all
+	for (i = 0; i < 2; i++) {
+		MAIN_GetVfo(i, &Vfo[i]);
+		if (Vfo[i].bIsDTMF != Cache[i].bIsDTMF) {
+			bIsCacheValid = false;
 		}
-		if (gEeprom.VfoInfo[i].CHANNEL_BANDWIDTH == BANDWIDTH_NARROW) {
-			memcpy(pLine1 + 128 + 74, BITMAP_NarrowBand, sizeof(BITMAP_NarrowBand));
+	}
+
+	Dirty = 0;
+	if (!bIsCacheValid) {
+		memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+		Dirty = 0x7FU;
+	}
+
+	for (i = 0; i < 2; i++) {
+		if (Vfo[i].bIsDTMF) {
+			if (!bIsCacheValid || memcmp(Vfo[i].Text, Cache[i].Text, sizeof(Vfo[i].Text))) {
+				MAIN_DrawDTMF(i, &Vfo[i]);
+				Dirty |= 0x0FU << (i * 3);
+			}
+			continue;
 		}
-		if (gEeprom.VfoInfo[i].DTMF_DECODING_ENABLE) {
-			memcpy(pLine1 + 128 + 84, BITMAP_DTMF, sizeof(BITMAP_DTMF));
+		if (!bIsCacheValid || memcmp(&Vfo[i].Top, &Cache[i].Top, sizeof(Vfo[i].Top))) {
+			MAIN_DrawTop(i, &Vfo[i].Top);
+			Dirty |= 0x03U << (i * 4);
 		}
-		if (gEeprom.VfoInfo[i].SCRAMBLING_TYPE && gSetting_ScrambleEnable) {
-			memcpy(pLine1 + 128 + 110, BITMAP_Scramble, sizeof(BITMAP_Scramble));
+		if (!bIsCacheValid || memcmp(&Vfo[i].Info, &Cache[i].Info, sizeof(Vfo[i].Info))) {
+			MAIN_DrawInfo(i, &Vfo[i].Info);
+			Dirty |= 0x04U << (i * 4);
 		}
 	}
 
-	ST7565_BlitFullScreen();
+	memcpy(Cache, Vfo, sizeof(Cache));
+
+	if (!bIsCacheValid) {
+		bIsCacheValid = true;
+		ST7565_BlitFullScreen();
+		return;
+	}
+
+	for (Line = 0; Line < 7; Line++) {
+		if (Dirty & (1U << Line)) {
+			ST7565_DrawLine(0, Line + 1, sizeof(gFrameBuffer[0]), gFrameBuffer[Line], false);
+		}
+	}
 }
 
@@ -55,6 +55,11 @@ static const char MenuList[][11] = {
 	// 0x38
 };
 
+// The menu titles are too many to pre-render in flash, so the two pages of
+// the last one drawn are kept and copied back while the cursor stays put.
+static uint8_t TitleCache[2][128];
+static uint8_t TitleCursor = 0xFF;
+
 static const uint16_t gSubMenu_Step[] = {
 	250,
 	500,
@@ -87,12 +92,13 @@ static const char gSubMenu_OFF_ON[2][4] = {
 	"On",
 };
 
-static const char gSubMenu_SAVE[5][4] = {
+static const char gSubMenu_SAVE[6][4] = {
 	"Off",
 	"1:1",
 	"1:2",
 	"1:3",
 	"1:4",
+	"AUT",
 };
 
 static const char gSubMenu_CHAN[3][10] = {
@@ -186,7 +192,13 @@ void UI_DisplayMenu(void)
 	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
 
 
-	UI_PrintString(MenuList[gMenuCursor], 0, 127,  0, 11, true);
+	if (TitleCursor != gMenuCursor) {
+		UI_PrintString(MenuList[gMenuCursor], 0, 127,  0, 11, true);
+		memcpy(TitleCache, gFrameBuffer, sizeof(TitleCache));
+		TitleCursor = gMenuCursor;
+	} else {
+		memcpy(gFrameBuffer, TitleCache, sizeof(TitleCache));
+	}
 	for (i = 4; i < 123; i++) {
 		gFrameBuffer[1][i] |= 0b10000000; // 
 	}
@@ -204,11 +216,11 @@ void UI_DisplayMenu(void)
 	switch (gMenuCursor) {
 	case MENU_SQL:
 	case MENU_MIC:
-		sprintf(String, "%d", gSubMenuSelection);
+		UI_FormatNumber(String, gSubMenuSelection, 1, 0);
 		break;
 
 	case MENU_STEP:
-		sprintf(String, "%d.%02dKHz", gSubMenu_Step[gSubMenuSelection] / 100, gSubMenu_Step[gSubMenuSelection] % 100);
+		strcpy(UI_FormatNumber(String, gSubMenu_Step[gSubMenuSelection], 3, 2), "KHz");
 		break;
 
 	case MENU_TXP:
@@ -220,9 +232,9 @@ void UI_DisplayMenu(void)
 		if (gSubMenuSelection == 0) {
 			strcpy(String, "Off");
 		} else if (gSubMenuSelection < 105) {
-			sprintf(String, "D%03oN", DCS_Options[gSubMenuSelection - 1]);
+			UI_FormatDCS(String, DCS_Options[gSubMenuSelection - 1], 'N');
 		} else {
-			sprintf(String, "D%03oI", DCS_Options[gSubMenuSelection - 105]);
+			UI_FormatDCS(String, DCS_Options[gSubMenuSelection - 105], 'I');
 		}
 		break;
 
@@ -231,7 +243,7 @@ void UI_DisplayMenu(void)
 		if (gSubMenuSelection == 0) {
 			strcpy(String, "Off");
 		} else {
-			sprintf(String, "%d.%dHz", CTCSS_Options[gSubMenuSelection - 1] / 10, CTCSS_Options[gSubMenuSelection - 1] % 10);
+			UI_FormatCTCSS(String, CTCSS_Options[gSubMenuSelection - 1]);
 		}
 		break;
 
@@ -241,7 +253,7 @@ void UI_DisplayMenu(void)
 
 	case MENU_OFFSET:
 		if (!gIsInSubMenu || gInputBoxIndex == 0) {
-			sprintf(String, "%d.%05d", gSubMenuSelection / 100000, gSubMenuSelection % 100000);
+			UI_FormatFrequency(String, gSubMenuSelection);
 			break;
 		}
 		for (i = 0; i < 3; i++) {
@@ -276,7 +288,7 @@ void UI_DisplayMenu(void)
 		if (gSubMenuSelection == 0) {
 			strcpy(String, "Off");
 		} else {
-			sprintf(String, "%d", gSubMenuSelection);
+			UI_FormatNumber(String, gSubMenuSelection, 1, 0);
 		}
 		break;
 
@@ -322,7 +334,7 @@ void UI_DisplayMenu(void)
 		if (gSubMenuSelection == 0) {
 			strcpy(String, "Off");
 		} else {
-			sprintf(String, "%dmin", gSubMenuSelection);
+			strcpy(UI_FormatNumber(String, gSubMenuSelection, 1, 0), "min");
 		}
 		break;
 
@@ -338,16 +350,17 @@ void UI_DisplayMenu(void)
 		if (gSubMenuSelection == 0) {
 			strcpy(String, "Off");
 		} else {
-			sprintf(String, "%d*100ms", gSubMenuSelection);
+			strcpy(UI_FormatNumber(String, gSubMenuSelection, 1, 0), "*100ms");
 		}
 		break;
 
 	case MENU_S_LIST:
-		sprintf(String, "List %d", gSubMenuSelection);
+		strcpy(String, "List ");
+		UI_FormatNumber(String + 5, gSubMenuSelection, 1, 0);
 		break;
 
 	case MENU_LOCK_TYPE:
-		sprintf(String, gSubMenu_LOCK_TYPE[gSubMenuSelection]);
+		strcpy(String, gSubMenu_LOCK_TYPE[gSubMenuSelection]);
 		break;
 
 	case MENU_ANI_ID:
@@ -367,11 +380,11 @@ void UI_DisplayMenu(void)
 		break;
 
 	case MENU_D_HOLD:
-		sprintf(String, "%ds", gSubMenuSelection);
+		strcpy(UI_FormatNumber(String, gSubMenuSelection, 1, 0), "s");
 		break;
 
 	case MENU_D_PRE:
-		sprintf(String, "%d*10ms", gSubMenuSelection);
+		strcpy(UI_FormatNumber(String, gSubMenuSelection, 1, 0), "*10ms");
 		break;
 
 	case MENU_PTT_ID:
@@ -394,7 +407,7 @@ void UI_DisplayMenu(void)
 
 	case MENU_VOL:
     case MENU_CALIBRATION:
-        sprintf(String, "%d.%02dV", gBatteryVoltageAverage / 100, gBatteryVoltageAverage % 100);
+        UI_FormatVoltage(String, gBatteryVoltageAverage);
 		break;
 		
 	case MENU_F1_SHORT:
@@ -416,22 +429,17 @@ void UI_DisplayMenu(void)
 	UI_PrintString(String, 0, 127, 2, 10, true);
 
 	if (gMenuCursor == MENU_OFFSET) {
-		UI_PrintString("MHz", 0, 127, 4, 10, true);
+		UI_PrintRun(UI_RUN_MHZ, 4);
 	}
 	if (gMenuCursor == MENU_ABOUT) {
 		UI_PrintString(Version, 0, 127, 4, 10, true);
 	}
 	if ((gMenuCursor == MENU_RESET || gMenuCursor == MENU_MEM_CH || gMenuCursor == MENU_DEL_CH) && gAskForConfirmation) {
-		if (gAskForConfirmation == 1) {
-			strcpy(String, "SURE?");
-		} else {
-			strcpy(String, "WAIT!");
-		}
-		UI_PrintString(String, 0, 127, 4, 8, true);
+		UI_PrintRun(gAskForConfirmation == 1 ? UI_RUN_SURE : UI_RUN_WAIT, 4);
 	}
 
 	if ((gMenuCursor == MENU_R_CTCS || gMenuCursor == MENU_R_DCS) && gCssScanMode != CSS_SCAN_MODE_OFF) {
-		UI_PrintString("SCAN", 0, 127, 4, 8, true);
+		UI_PrintRun(UI_RUN_SCAN, 4);
 	}
 
 	if (gMenuCursor == MENU_UPCODE) {
@@ -464,7 +472,7 @@ void UI_DisplayMenu(void)
 		i = gMenuCursor - MENU_SLIST1;
 
 		if (gSubMenuSelection == 0xFF) {
-			sprintf(String, "NULL");
+			strcpy(String, "NULL");
 		} else {
 			UI_GenerateChannelStringEx(String, true, (uint8_t)gSubMenuSelection);
 		}
@@ -474,11 +482,13 @@ void UI_DisplayMenu(void)
 		} else {
 			UI_PrintString(String, 0, 127, 0, 8, 1);
 			if (IS_MR_CHANNEL(gEeprom.SCANLIST_PRIORITY_CH1[i])) {
-				sprintf(String, "PRI1:%d", gEeprom.SCANLIST_PRIORITY_CH1[i] + 1);
+				strcpy(String, "PRI1:");
+				UI_FormatNumber(String + 5, gEeprom.SCANLIST_PRIORITY_CH1[i] + 1, 1, 0);
 				UI_PrintString(String, 0, 127, 2, 8, 1);
 			}
 			if (IS_MR_CHANNEL(gEeprom.SCANLIST_PRIORITY_CH2[i])) {
-				sprintf(String, "PRI2:%d", gEeprom.SCANLIST_PRIORITY_CH2[i] + 1);
+				strcpy(String, "PRI2:");
+				UI_FormatNumber(String + 5, gEeprom.SCANLIST_PRIORITY_CH2[i] + 1, 1, 0);
 				UI_PrintString(String, 0, 127, 4, 8, 1);
 			}
 		}
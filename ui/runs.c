@@ -0,0 +1,116 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Generated by gen-runs.py from ui/runs.def, do not edit.
+
+#include "ui/runs.h"
+
+const UI_Run_t gRuns[9] = {
+	{    0,  16,  95 }, // Long Press #
+	{  190,  29,  70 }, // To Unlock
+	{  330,  48,  31 }, // SCAN
+	{  392,  44,  39 }, // SURE?
+	{  470,  44,  38 }, // WAIT!
+	{  546,  44,  39 }, // SAVE?
+	{  624,  49,  27 }, // MHz
+	{  678,   2,  69 }, // SCAN CMP.
+	{  816,   2,  77 }, // SCAN FAIL.
+};
+
+const uint8_t gRunData[970] = {
+	0x08, 0xF8, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x40, 0x40,
+	0x40, 0xC0, 0x80, 0x00, 0x40, 0xC0, 0x80, 0x40, 0x40, 0xC0, 0x80, 0x00,
+	0x80, 0xC0, 0x40, 0x40, 0x80, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xF8, 0x88, 0x88, 0xF8, 0x70, 0x00,
+	0x40, 0xC0, 0x80, 0xC0, 0x40, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0x40, 0x40,
+	0x40, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00,
+	0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0xF0, 0xF0, 0x40, 0xF0, 0xF0, 0x40, 0x10,
+	0x1F, 0x1F, 0x10, 0x10, 0x18, 0x1C, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10,
+	0x1F, 0x0F, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x4F,
+	0xDF, 0x90, 0x90, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x1F, 0x1F, 0x10, 0x00, 0x00, 0x01, 0x00, 0x0F, 0x1F, 0x11, 0x11, 0x11,
+	0x19, 0x09, 0x00, 0x08, 0x19, 0x13, 0x12, 0x16, 0x1C, 0x08, 0x00, 0x08,
+	0x19, 0x13, 0x12, 0x16, 0x1C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x1F, 0x1F, 0x04, 0x1F, 0x1F, 0x04, 0x38, 0x18,
+	0xF8, 0xF8, 0x18, 0x38, 0x00, 0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00,
+	0x00, 0x00, 0xF8, 0xF8, 0x00, 0x40, 0xC0, 0x80, 0x40, 0x40, 0xC0, 0x80,
+	0x00, 0x00, 0x00, 0x08, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x40,
+	0x40, 0x40, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80,
+	0x00, 0x08, 0xF8, 0xF8, 0x00, 0x80, 0xC0, 0x40, 0x00, 0x10, 0x1F, 0x1F,
+	0x10, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x1F, 0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10,
+	0x1F, 0x0F, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00,
+	0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10,
+	0x1F, 0x0F, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x18, 0x08, 0x00, 0x10,
+	0x1F, 0x1F, 0x03, 0x07, 0x1C, 0x18, 0x30, 0x78, 0xC8, 0x88, 0x88, 0x38,
+	0x30, 0x00, 0xE0, 0xF0, 0x18, 0x08, 0x08, 0x18, 0x30, 0x00, 0xC0, 0xE0,
+	0x30, 0x18, 0x30, 0xE0, 0xC0, 0x00, 0xF8, 0xF8, 0x70, 0xE0, 0xC0, 0xF8,
+	0xF8, 0x0C, 0x1C, 0x10, 0x10, 0x11, 0x1F, 0x0E, 0x00, 0x07, 0x0F, 0x18,
+	0x10, 0x10, 0x18, 0x0C, 0x00, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x1F, 0x1F,
+	0x00, 0x1F, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x1F, 0x30, 0x78, 0xC8, 0x88,
+	0x88, 0x38, 0x30, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00,
+	0x08, 0xF8, 0xF8, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x08, 0xF8, 0xF8, 0x88,
+	0xC8, 0x18, 0x38, 0x00, 0x30, 0x38, 0x08, 0x88, 0xC8, 0x78, 0x30, 0x0C,
+	0x1C, 0x10, 0x10, 0x11, 0x1F, 0x0E, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10,
+	0x1F, 0x0F, 0x00, 0x10, 0x1F, 0x1F, 0x00, 0x01, 0x1F, 0x1E, 0x00, 0x10,
+	0x1F, 0x1F, 0x10, 0x11, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1B,
+	0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0xC0, 0xE0,
+	0x30, 0x18, 0x30, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xF8, 0x08,
+	0x00, 0x00, 0x00, 0x38, 0x18, 0xF8, 0xF8, 0x18, 0x38, 0x00, 0x00, 0x00,
+	0x70, 0xF8, 0xF8, 0x70, 0x07, 0x1F, 0x1C, 0x07, 0x1C, 0x1F, 0x07, 0x00,
+	0x1F, 0x1F, 0x01, 0x01, 0x01, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x10, 0x1F,
+	0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1B, 0x1B, 0x00, 0x30, 0x78, 0xC8, 0x88, 0x88, 0x38,
+	0x30, 0x00, 0xC0, 0xE0, 0x30, 0x18, 0x30, 0xE0, 0xC0, 0x00, 0xF8, 0xF8,
+	0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x08, 0xF8, 0xF8, 0x88, 0xC8, 0x18,
+	0x38, 0x00, 0x30, 0x38, 0x08, 0x88, 0xC8, 0x78, 0x30, 0x0C, 0x1C, 0x10,
+	0x10, 0x11, 0x1F, 0x0E, 0x00, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x1F, 0x1F,
+	0x00, 0x03, 0x07, 0x0C, 0x18, 0x0C, 0x07, 0x03, 0x00, 0x10, 0x1F, 0x1F,
+	0x10, 0x11, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1B, 0x00, 0x00,
+	0xF8, 0xF8, 0x70, 0xE0, 0x70, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+	0x80, 0x80, 0x80, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x40, 0x40,
+	0xC0, 0xC0, 0x40, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00,
+	0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x18,
+	0x1C, 0x16, 0x13, 0x11, 0x18, 0x18, 0x30, 0x78, 0xC8, 0x88, 0x88, 0x38,
+	0x30, 0x00, 0xE0, 0xF0, 0x18, 0x08, 0x08, 0x18, 0x30, 0x00, 0xC0, 0xE0,
+	0x30, 0x18, 0x30, 0xE0, 0xC0, 0x00, 0xF8, 0xF8, 0x70, 0xE0, 0xC0, 0xF8,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF0,
+	0x18, 0x08, 0x08, 0x18, 0x30, 0x00, 0xF8, 0xF8, 0x70, 0xE0, 0x70, 0xF8,
+	0xF8, 0x00, 0x08, 0xF8, 0xF8, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0C, 0x1C, 0x10, 0x10, 0x11, 0x1F, 0x0E, 0x00, 0x07,
+	0x0F, 0x18, 0x10, 0x10, 0x18, 0x0C, 0x00, 0x1F, 0x1F, 0x01, 0x01, 0x01,
+	0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x1F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x18, 0x10, 0x10,
+	0x18, 0x0C, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x10,
+	0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+	0x30, 0x78, 0xC8, 0x88, 0x88, 0x38, 0x30, 0x00, 0xE0, 0xF0, 0x18, 0x08,
+	0x08, 0x18, 0x30, 0x00, 0xC0, 0xE0, 0x30, 0x18, 0x30, 0xE0, 0xC0, 0x00,
+	0xF8, 0xF8, 0x70, 0xE0, 0xC0, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xF8, 0x88, 0xC8, 0x18, 0x38, 0x00,
+	0xC0, 0xE0, 0x30, 0x18, 0x30, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF8,
+	0xF8, 0x08, 0x00, 0x00, 0x08, 0xF8, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x1C, 0x10, 0x10, 0x11, 0x1F, 0x0E,
+	0x00, 0x07, 0x0F, 0x18, 0x10, 0x10, 0x18, 0x0C, 0x00, 0x1F, 0x1F, 0x01,
+	0x01, 0x01, 0x1F, 0x1F, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x1F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F,
+	0x10, 0x01, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x1F, 0x1F,
+	0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x10, 0x1F, 0x1F,
+	0x10, 0x10, 0x18, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+};
+
@@ -0,0 +1,48 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+// Generated by gen-runs.py from ui/runs.def, do not edit.
+
+#ifndef UI_RUNS_H
+#define UI_RUNS_H
+
+#include <stdint.h>
+
+typedef struct {
+	uint16_t Offset;
+	uint8_t Start;
+	uint8_t Columns;
+} UI_Run_t;
+
+enum UI_RUN_ID {
+	UI_RUN_LONG_PRESS = 0,
+	UI_RUN_TO_UNLOCK,
+	UI_RUN_SCAN,
+	UI_RUN_SURE,
+	UI_RUN_WAIT,
+	UI_RUN_SAVE,
+	UI_RUN_MHZ,
+	UI_RUN_SCAN_CMP,
+	UI_RUN_SCAN_FAIL,
+};
+
+typedef enum UI_RUN_ID UI_RUN_ID;
+
+extern const UI_Run_t gRuns[9];
+extern const uint8_t gRunData[970];
+
+#endif
+
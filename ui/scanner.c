@@ -19,7 +19,6 @@
 #include "app/scanner.h"
 #include "dcs.h"
 #include "driver/st7565.h"
-#include "external/printf/printf.h"
 #include "misc.h"
 #include "ui/helper.h"
 #include "ui/scanner.h"
@@ -27,53 +26,47 @@
 void UI_DisplayScanner(void)
 {
 	char String[16];
-	bool bCentered;
-	uint8_t Start;
 
 	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
 	memset(String, 0, sizeof(String));
 
 	if (gScanSingleFrequency || (gScanCssState != SCAN_CSS_STATE_OFF && gScanCssState != SCAN_CSS_STATE_FAILED)) {
-		sprintf(String, "FREQ:%d.%05d", gScanFrequency / 100000, gScanFrequency % 100000);
+		strcpy(String, "FREQ:");
+		UI_FormatFrequency(String + 5, gScanFrequency);
 	} else {
-		sprintf(String, "FREQ:**.*****");
+		strcpy(String, "FREQ:**.*****");
 	}
 	UI_PrintString(String, 2, 127, 1, 8, 0);
 	memset(String, 0, sizeof(String));
 
 	if (gScanCssState < SCAN_CSS_STATE_FOUND || !gScanUseCssResult) {
-		sprintf(String, "CTC:******");
+		strcpy(String, "CTC:******");
 	} else if (gScanCssResultType == CODE_TYPE_CONTINUOUS_TONE) {
-		sprintf(String, "CTC:%d.%dHz", CTCSS_Options[gScanCssResultIndex] / 10, CTCSS_Options[gScanCssResultIndex] % 10);
+		strcpy(String, "CTC:");
+		UI_FormatCTCSS(String + 4, CTCSS_Options[gScanCssResultIndex]);
 	} else {
-		sprintf(String, "DCS:D%03oN", DCS_Options[gScanCssResultIndex]);
+		strcpy(String, "DCS:");
+		UI_FormatDCS(String + 4, DCS_Options[gScanCssResultIndex], 'N');
 	}
 	UI_PrintString(String, 2, 127, 3, 8, 0);
 	memset(String, 0, sizeof(String));
 
 	if (gScannerEditState == 2) {
-		strcpy(String, "SAVE?");
-		Start = 0;
-		bCentered = 1;
-	} else {
+		UI_PrintRun(UI_RUN_SAVE, 5);
+	} else if (gScannerEditState == 1 || gScanCssState < SCAN_CSS_STATE_FOUND) {
 		if (gScannerEditState == 1) {
 			strcpy(String, "SAVE:");
 			UI_GenerateChannelStringEx(String + 5, gShowChPrefix, gScanChannel);
-		} else if (gScanCssState < SCAN_CSS_STATE_FOUND) {
+		} else {
 			strcpy(String, "SCAN");
 			memset(String + 4, '.', (gScanProgressIndicator & 7) + 1);
-		} else {
-			if (gScanCssState == SCAN_CSS_STATE_FOUND) {
-				strcpy(String, "SCAN CMP.");
-			} else {
-				strcpy(String, "SCAN FAIL.");
-			}
 		}
-		Start = 2;
-		bCentered = 0;
+		UI_PrintString(String, 2, 127, 5, 8, false);
+	} else if (gScanCssState == SCAN_CSS_STATE_FOUND) {
+		UI_PrintRun(UI_RUN_SCAN_CMP, 5);
+	} else {
+		UI_PrintRun(UI_RUN_SCAN_FAIL, 5);
 	}
-
-	UI_PrintString(String, Start, 127, 5, 8, bCentered);
 	ST7565_BlitFullScreen();
 }
 
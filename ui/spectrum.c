@@ -0,0 +1,148 @@
+/* Copyright 2023 Dual Tachyon
+ * https://github.com/DualTachyon
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *     Unless required by applicable law or agreed to in writing, software
+ *     distributed under the License is distributed on an "AS IS" BASIS,
+ *     WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *     See the License for the specific language governing permissions and
+ *     limitations under the License.
+ */
+
+#include <string.h>
+#include "app/spectrum.h"
+#include "driver/st7565.h"
+#include "ui/helper.h"
+#include "ui/spectrum.h"
+#include "ui/ui.h"
+
+// Bars use frame buffer lines 2 to 4, 3dB per pixel from -130dBm to -58dBm.
+// The waterfall scrolls down on lines 5 and 6, newest row at the top.
+#define SPECTRUM_BAR_LINE		2U
+#define SPECTRUM_BAR_HEIGHT		24U
+#define SPECTRUM_FLOOR			30U
+#define SPECTRUM_WATERFALL_LINE		5U
+
+static uint16_t DisplayedRate;
+
+static uint8_t SPECTRUM_Scale(uint8_t Level)
+{
+	if (Level <= SPECTRUM_FLOOR) {
+		return 0;
+	}
+	Level = (Level - SPECTRUM_FLOOR) / 3;
+	if (Level > SPECTRUM_BAR_HEIGHT) {
+		return SPECTRUM_BAR_HEIGHT;
+	}
+
+	return Level;
+}
+
+static void SPECTRUM_DrawHeader(void)
+{
+	char String[17];
+	char *pString;
+
+	memset(gFrameBuffer[0], 0, sizeof(gFrameBuffer[0]) * 2);
+	pString = UI_FormatNumber(String, gSpectrumCenter / 100, 4, 3);
+	*pString++ = ' ';
+	pString = UI_FormatNumber(pString, gSpectrumRate, 1, 0);
+	strcpy(pString, "/s");
+	UI_PrintString(String, 0, 127, 0, 8, true);
+	DisplayedRate = gSpectrumRate;
+}
+
+static void SPECTRUM_DrawBars(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < SPECTRUM_POINTS; i++) {
+		const uint8_t Height = SPECTRUM_Scale(gSpectrumRSSI[i]);
+		const uint8_t Peak = SPECTRUM_Scale(gSpectrumPeak[i]);
+		uint8_t Line;
+
+		for (Line = 0; Line < SPECTRUM_BAR_HEIGHT / 8; Line++) {
+			uint8_t Bits = 0;
+			uint8_t Bit;
+
+			for (Bit = 0; Bit < 8; Bit++) {
+				const uint8_t Y = (SPECTRUM_BAR_HEIGHT - 1) - ((Line * 8) + Bit);
+
+				if (Y < Height || (Peak && Y == Peak - 1)) {
+					Bits |= 1U << Bit;
+				}
+			}
+			gFrameBuffer[SPECTRUM_BAR_LINE + Line][i] = Bits;
+		}
+	}
+
+	// Center marker
+	gFrameBuffer[SPECTRUM_WATERFALL_LINE - 1][SPECTRUM_POINTS / 2] |= 0x80;
+	gFrameBuffer[SPECTRUM_WATERFALL_LINE - 1][(SPECTRUM_POINTS / 2) - 1] |= 0x80;
+}
+
+// 2-bit levels are shown as 0%, 25%, 50% and 100% ordered dither
+static void SPECTRUM_DrawWaterfall(void)
+{
+	uint8_t Line;
+
+	for (Line = SPECTRUM_WATERFALL_LINE; Line < 7; Line++) {
+		uint8_t *pLine = gFrameBuffer[Line];
+		uint8_t Bit;
+
+		memset(pLine, 0, sizeof(gFrameBuffer[0]));
+		for (Bit = 0; Bit < 8; Bit++) {
+			const uint8_t Age = ((Line - SPECTRUM_WATERFALL_LINE) * 8) + Bit;
+			const uint8_t *pRow = SPECTRUM_GetWaterfallRow(Age);
+			uint8_t i;
+
+			if (pRow == NULL) {
+				break;
+			}
+			for (i = 0; i < SPECTRUM_POINTS; i++) {
+				const uint8_t Level = (pRow[i / 4] >> ((i & 3) * 2)) & 3;
+
+				if (Level == 3 || (Level == 2 && ((i + Age) & 1) == 0) || (Level == 1 && (i & 1) == 0 && (Age & 1) == 0)) {
+					pLine[i] |= 1U << Bit;
+				}
+			}
+		}
+	}
+}
+
+void UI_DisplaySpectrum(void)
+{
+	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+	SPECTRUM_DrawHeader();
+	SPECTRUM_DrawBars();
+	SPECTRUM_DrawWaterfall();
+	ST7565_BlitFullScreen();
+}
+
+// Called once per sweep, only the pages that changed are sent to the LCD
+void UI_UpdateSpectrum(void)
+{
+	uint8_t Line;
+
+	if (gScreenToDisplay != DISPLAY_SPECTRUM) {
+		return;
+	}
+
+	Line = SPECTRUM_BAR_LINE;
+	if (DisplayedRate != gSpectrumRate) {
+		SPECTRUM_DrawHeader();
+		Line = 0;
+	}
+	SPECTRUM_DrawBars();
+	SPECTRUM_DrawWaterfall();
+
+	for (; Line < 7; Line++) {
+		ST7565_DrawLine(0, Line + 1, sizeof(gFrameBuffer[0]), gFrameBuffer[Line], false);
+	}
+}
+
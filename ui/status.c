@@ -21,7 +21,6 @@
 #include "driver/st7565.h"
 #include "functions.h"
 #include "helper/battery.h"
-#include "external/printf/printf.h"
 #include "misc.h"
 #include "settings.h"
 #include "ui/status.h"
@@ -90,9 +89,7 @@ void UI_DisplayStatus(void)
 	if (gEeprom.DUAL_WATCH != DUAL_WATCH_OFF) {
 		memcpy(gStatusLine + 25, BITMAP_TDR, sizeof(BITMAP_TDR));
 	}
-    sprintf(StatusbarString, "%d.%02dV",
-                        gBatteryVoltageAverage / 100,
-                        gBatteryVoltageAverage % 100);
+    UI_FormatVoltage(StatusbarString, gBatteryVoltageAverage);
     UI_DisplayStatusbarString(92);
     ST7565_BlitStatusLine();
         }
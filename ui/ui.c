@@ -23,6 +23,7 @@
 #include "ui/main.h"
 #include "ui/menu.h"
 #include "ui/scanner.h"
+#include "ui/spectrum.h"
 #include "ui/ui.h"
 
 GUI_DisplayType_t gScreenToDisplay;
@@ -44,6 +45,9 @@ void GUI_DisplayScreen(void)
 	case DISPLAY_SCANNER:
 		UI_DisplayScanner();
 		break;
+	case DISPLAY_SPECTRUM:
+		UI_DisplaySpectrum();
+		break;
 	default:
 		break;
 	}
@@ -63,6 +67,7 @@ void GUI_SelectNextDisplay(GUI_DisplayType_t Display)
 			gF_LOCK = false;
 			gAskToSave = false;
 			gAskToDelete = false;
+			UI_InvalidateMain();
 			if (gWasFKeyPressed) {
 				gWasFKeyPressed = false;
 				gUpdateStatus = true;
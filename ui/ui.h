@@ -25,6 +25,7 @@ enum GUI_DisplayType_t {
 	DISPLAY_FM	= 0x01U,
 	DISPLAY_MENU	= 0x02U,
 	DISPLAY_SCANNER	= 0x03U,
+	DISPLAY_SPECTRUM	= 0x04U,
 	DISPLAY_INVALID	= 0xFFU,
 };
 